@@ -3,6 +3,9 @@
 // Do not use to train AI / LLM / neural network
 
 #include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueStats.h"
+#include "Dialogue/DialogueMemory.h"
+#include "Dialogue/OneLineDialogue.h"
 #include "Runtime/Engine/Public/Internationalization/StringTable.h"
 #include "Core/Public/Internationalization/StringTableCore.h"
 #include "GameFramework/PlayerController.h"
@@ -12,11 +15,28 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
 #include "EdGraphNode_Comment.h"
+#include "Dialogue/DialogueTextPinIndex.h"
+#include "Dialogue/DialogueLineTokenizer.h"
+#include "Dialogue/DialogueScriptExporter.h"
+#include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "ScopedTransaction.h"
+#include "Misc/FileHelper.h"
 #endif //
 
 #include "Kismet/GameplayStatics.h"
 #include "Dialogue/DialogueManager.h"
 
+//=================================================================
+// String table key of a line for telemetry and pacing
+//=================================================================
+static FName GetTelemetryKey(const FText &InText)
+{
+	TOptional<FString> Key = FTextInspector::GetKey(InText);
+	return Key.IsSet() ? FName(*Key.GetValue()) : NAME_None;
+}
+
 //=================================================================
 // 
 //=================================================================
@@ -27,9 +47,16 @@ void UDialogue::Init(class UDialogueManager *InDialogueManager, class APlayerCon
 	PlayerActor = InPlayer;
 	DialogueTarget = InActor;
 	SpeakContext = InSpeakContext;
-	bIsActive = true;
 	FinishedLatentInfo = InLatentInfo;
 
+	if (!bIsActive)
+	{
+		INC_DWORD_STAT(IsA<UOneLineDialogue>() ? STAT_DialogueActiveBarks : STAT_DialogueActive);
+		INC_MEMORY_STAT_BY(STAT_DialogueObjectMemory, GetClass()->GetStructureSize());
+	}
+
+	bIsActive = true;
+
 	LastClickedAsset = NULL;
 	LastClickedOption = NAME_None;
 }
@@ -174,12 +201,12 @@ bool UDialogue::GoChoicesDirection(int32 InDirection)
 		GetChoicesLimited_Internal(NULL, MaxChoices);
 
 		StartChoices = FMath::Min(MaxChoices, StartChoices + DialogueManager->GetMaxChoices());
-		DialogueManager->QueueDialogueUpdate();
+		DialogueManager->MarkDialogueDirty(EDialogueDirty::Page);
 		return true;
 	}
 
 	StartChoices = FMath::Max(0, StartChoices - DialogueManager->GetMaxChoices());
-	DialogueManager->QueueDialogueUpdate();
+	DialogueManager->MarkDialogueDirty(EDialogueDirty::Page);
 	return true;
 }
 
@@ -218,8 +245,13 @@ void UDialogue::Deactivate()
 	bIsActive = false;
 	OnDeactivate();
 
+	DEC_DWORD_STAT(IsA<UOneLineDialogue>() ? STAT_DialogueActiveBarks : STAT_DialogueActive);
+	DEC_MEMORY_STAT_BY(STAT_DialogueObjectMemory, GetClass()->GetStructureSize());
+	DEC_MEMORY_STAT_BY(STAT_DialogueChoicesMemory, Choices.GetAllocatedSize());
+
 	CustomSpeakers.Reset();
 
+	Choices.Empty();
 	ClearChoices();
 	ClearDialogueBox();
 
@@ -241,6 +273,13 @@ void UDialogue::Deactivate()
 //=================================================================
 void UDialogue::Update(float DeltaTime)
 {
+#if SIMPLEDIALOGUE_PACING
+	if (Box_IsValid && !HasChoices() && !Paused)
+	{
+		Box_Shown += DeltaTime;
+	}
+#endif //
+
 	if (HasDuration() && !Paused)
 	{
 		Box_Time -= DeltaTime;
@@ -263,9 +302,17 @@ void UDialogue::Skip()
 	if (!Box_IsValid || HasChoices())
 		return;	
 
+#if SIMPLEDIALOGUE_PACING
+	//Update sets Box_Time to zero before skipping, anything left means the player was faster
+	if (FDialoguePacing::IsRecording() && GetWorld() && GetWorld()->IsGameWorld())
+	{
+		FDialoguePacing::Get().AddLine(GetClass()->GetFName(), Box_TelemetryKey, Box_Shown, Box_Delay, DialogueManager->GetTextCache().GetDisplayString(Box_Text).Len(), Box_HasDelay() && Box_Time > 0.0f);
+	}
+#endif //
+
 	Box_IsValid = false;
 
-	DialogueManager->QueueDialogueUpdate();
+	DialogueManager->MarkDialogueDirty(EDialogueDirty::Text | EDialogueDirty::Time);
 	DialogueManager->MarkShouldUpdateSpeaker();
 
 	DialogueManager->SetDialogueHoveredAsset(NULL);
@@ -286,12 +333,15 @@ void UDialogue::ClearDialogueBox()
 //=================================================================
 void UDialogue::Box_Execute()
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(Box_Execute);
+	SIMPLEDIALOGUE_TRACE(Execute, this, Box_ExecutionFunction, Box_OutputLink);
+
 	if (Box_IsValidFunction())
 	{
 		UFunction *pExecutionFunction = FindFunction(Box_ExecutionFunction);
 		if (pExecutionFunction)
 		{ 
-			UE_LOG(LogTemp, Warning, TEXT("Executing function \"%s\" with output linkage [%d]"), *Box_ExecutionFunction.ToString(), Box_OutputLink);
+			UE_LOG(LogTemp, Verbose, TEXT("Executing function \"%s\" with output linkage [%d]"), *Box_ExecutionFunction.ToString(), Box_OutputLink);
 			ProcessEvent(pExecutionFunction, &Box_OutputLink);
 			return;
 		}
@@ -398,6 +448,8 @@ class AActor *UDialogue::GetCustomSpeaker(FGameplayTag InTag) const
 //=================================================================
 void UDialogue::DialogueBox(EDialogueSpeaker Speaker, FText Text, FLatentActionInfo LatentInfo, float Duration, EDialogueExpression Expression, EDialogueEffect Effect, FGameplayTag VoiceOver, FGameplayTag InCustomTag)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(DialogueBox);
+
 	if (!IsActive())
 		return;
 
@@ -430,7 +482,7 @@ void UDialogue::DialogueBox(EDialogueSpeaker Speaker, FText Text, FLatentActionI
 
 	if (Duration < -0.0f)
 	{
-		Duration = FMath::Max( DialogueManager->GetAdditionalTextTime() + (DialogueManager->GetTimePerLetter() * Text.ToString().Len()), DialogueManager->GetMinimumTextTime());
+		Duration = DialogueManager->GetTextDuration(Text);
 	}
 
 	Box_IsValid = true;
@@ -439,8 +491,25 @@ void UDialogue::DialogueBox(EDialogueSpeaker Speaker, FText Text, FLatentActionI
 	Box_Effect = Effect;
 	Box_Actor = pActor;
 	Box_Time = Box_Delay = Duration;
+#if SIMPLEDIALOGUE_PACING
+	Box_Shown = 0.0f;
+#endif //
+	Box_TelemetryKey = FDialogueTelemetry::IsRecording() || FDialoguePacing::IsRecording() ? GetTelemetryKey(Text) : NAME_None;
+
+	FDialogueStats::AddLine();
+	if (FDialogueTelemetry::IsRecording())
+	{
+		DialogueManager->RecordTelemetry(EDialogueTelemetryEvent::Line, Box_TelemetryKey);
+	}
+	SIMPLEDIALOGUE_TRACE(Line, this, (uint8)Speaker, VoiceOver, InCustomTag, Duration);
+
+	DialogueManager->OnDialogueNative.Broadcast(pActor, Text);
 
-	DialogueManager->OnDialogue.Broadcast(pActor, Text);
+	if (DialogueManager->OnDialogue.IsBound())
+	{
+		SIMPLEDIALOGUE_BROADCAST_SCOPE(OnDialogue);
+		DialogueManager->OnDialogue.Broadcast(pActor, Text);
+	}
 	
 	if (LatentInfo.Linkage == INDEX_NONE)
 	{
@@ -459,7 +528,7 @@ void UDialogue::DialogueBox(EDialogueSpeaker Speaker, FText Text, FLatentActionI
 		UE_LOG(LogTemp, Warning, TEXT("WARNING! WARNING! Dialogue box has function defined when there's choices!"));
 	}
 
-	DialogueManager->QueueDialogueUpdate();
+	DialogueManager->MarkDialogueDirty(EDialogueDirty::Text | EDialogueDirty::Time);
 	DialogueManager->MarkShouldUpdateSpeaker();
 
 	PlayVoiceOver(pActor, VoiceOver, Expression);
@@ -505,7 +574,7 @@ void UDialogue::DialogueBoxNoLatent(EDialogueSpeaker Speaker, FText Text, float
 
 	if (Duration < -0.0f)
 	{
-		Duration = FMath::Max( DialogueManager->GetAdditionalTextTime() + (DialogueManager->GetTimePerLetter() * Text.ToString().Len()), DialogueManager->GetMinimumTextTime());
+		Duration = DialogueManager->GetTextDuration(Text);
 	}
 
 	Box_IsValid = true;
@@ -516,6 +585,16 @@ void UDialogue::DialogueBoxNoLatent(EDialogueSpeaker Speaker, FText Text, float
 	Box_Time = Box_Delay = Duration;	
 	Box_ExecutionFunction = NAME_None;
 	Box_OutputLink = INDEX_NONE;
+#if SIMPLEDIALOGUE_PACING
+	Box_Shown = 0.0f;
+#endif //
+	Box_TelemetryKey = FDialogueTelemetry::IsRecording() || FDialoguePacing::IsRecording() ? GetTelemetryKey(Text) : NAME_None;
+
+	FDialogueStats::AddLine();
+	if (FDialogueTelemetry::IsRecording())
+	{
+		DialogueManager->RecordTelemetry(EDialogueTelemetryEvent::Line, Box_TelemetryKey);
+	}
 
 	//Make sure
 	if (HasChoices() && Box_IsValidFunction())
@@ -523,7 +602,7 @@ void UDialogue::DialogueBoxNoLatent(EDialogueSpeaker Speaker, FText Text, float
 		UE_LOG(LogTemp, Warning, TEXT("WARNING! WARNING! Dialogue box has function defined when there's choices!"));
 	}
 
-	DialogueManager->QueueDialogueUpdate();
+	DialogueManager->MarkDialogueDirty(EDialogueDirty::Text | EDialogueDirty::Time);
 	DialogueManager->MarkShouldUpdateSpeaker();
 
 	PlayVoiceOver(pActor, VoiceOver, Expression);
@@ -543,6 +622,8 @@ void UDialogue::ClearChoices()
 //=================================================================
 void UDialogue::DialogueChoices(FText Text, FLatentActionInfo LatentInfo, bool Enabled, FName CustomChoiceName, bool DisableVisited, class UDataAsset *ChoiceAsset)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(DialogueChoices);
+
 	if (LatentInfo.CallbackTarget != this)
 		return;
 
@@ -562,7 +643,9 @@ void UDialogue::DialogueChoices(FText Text, FLatentActionInfo LatentInfo, bool E
 		choice.ChoiceName = CustomChoiceName.IsNone() ? *FString::Printf(TEXT("%s_%d"), *LatentInfo.ExecutionFunction.ToString(), LatentInfo.Linkage) : CustomChoiceName;
 	}
 
+	const SIZE_T OldChoicesSize = Choices.GetAllocatedSize();
 	Choices.Add(choice);
+	INC_MEMORY_STAT_BY(STAT_DialogueChoicesMemory, Choices.GetAllocatedSize() - OldChoicesSize);
 
 	const TArray<FName> &InVisitedChoices = VisitedChoices;
 
@@ -581,7 +664,10 @@ void UDialogue::DialogueChoices(FText Text, FLatentActionInfo LatentInfo, bool E
 		return A.OriginalIndex < B.OriginalIndex;
 	});
 
-	DialogueManager->QueueDialogueUpdate();
+	SIMPLEDIALOGUE_TRACE(Choice, this, LatentInfo.ExecutionFunction, LatentInfo.Linkage, Choices.Num());
+	DialogueManager->RecordTelemetry(EDialogueTelemetryEvent::ChoiceOffered, choice.ChoiceName, choice.OriginalIndex);
+
+	DialogueManager->MarkDialogueDirty(EDialogueDirty::Choices);
 	DialogueManager->MarkShouldUpdateSpeaker();
 }
 
@@ -614,7 +700,7 @@ bool UDialogue::HoverOption(int32 Index)
 
 	DialogueManager->SetDialogueHoveredAsset(Choices.GetData()[Index].ChoiceAsset);
 
-	DialogueManager->OnDialogueUpdated.Broadcast();
+	DialogueManager->BroadcastDialogueUpdate(EDialogueDirty::Hovered);
 	return true;
 }
 
@@ -635,9 +721,10 @@ bool UDialogue::MoveUpDownOptions(int32 Direction)
 		if (Choices[NewChoice].Enabled)
 		{
 			HoveredChoice = NewChoice;
-			DialogueManager->OnDialogueUpdated.Broadcast();
 
-			UE_LOG(LogTemp, Warning, TEXT("New choice %d"), HoveredChoice);
+			DialogueManager->BroadcastDialogueUpdate(EDialogueDirty::Hovered);
+
+			UE_LOG(LogTemp, Verbose, TEXT("New choice %d"), HoveredChoice);
 			return true;
 		}
 
@@ -703,11 +790,43 @@ void UDialogue::GetEveryoneInvolved(TArray<class AActor*>& OutActors)
 	}
 }
 
+//=================================================================
+// 
+//=================================================================
+void UDialogue::GetMemoryUsage(FDialogueMemoryUsage &OutUsage) const
+{
+	OutUsage = FDialogueMemoryUsage();
+	OutUsage.Object = GetClass()->GetStructureSize();
+	OutUsage.Choices = Choices.GetAllocatedSize();
+	OutUsage.VisitedChoices = VisitedChoices.GetAllocatedSize();
+	OutUsage.CustomSpeakers = CustomSpeakers.GetAllocatedSize();
+
+	OutUsage.Text = Box_Text.ToString().GetAllocatedSize();
+	for (int32 i=0; i<Choices.Num(); i++)
+	{
+		OutUsage.Text += Choices.GetData()[i].Title.ToString().GetAllocatedSize();
+	}
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogue::GetResourceSizeEx(FResourceSizeEx &CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	FDialogueMemoryUsage Usage;
+	GetMemoryUsage(Usage);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Usage.Choices + Usage.VisitedChoices + Usage.CustomSpeakers + Usage.Text);
+}
+
 //=================================================================
 // 
 //=================================================================
 bool UDialogue::SelectOption(int32 Index)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(SelectOption);
+
 	if (!DialogueManager.Get())
 	{
 		UE_LOG(LogTemp, Fatal, TEXT("No dialogue manager!"));
@@ -746,9 +865,12 @@ bool UDialogue::SelectOption(int32 Index)
 
 			int32 OutputLink = Choices.GetData()[Index].OutputLink;
 
+			SIMPLEDIALOGUE_TRACE(Select, this, Index, Choices.GetData()[Index].ExecutionFunction);
+			DialogueManager->RecordTelemetry(EDialogueTelemetryEvent::ChoicePicked, Choices.GetData()[Index].ChoiceName, Choices.GetData()[Index].OriginalIndex);
+
 			ClearChoices();
 			ClearDialogueBox();
-			DialogueManager->QueueDialogueUpdate();
+			DialogueManager->MarkDialogueDirty(EDialogueDirty::Text | EDialogueDirty::Choices | EDialogueDirty::Hovered | EDialogueDirty::Page);
 
 			ProcessEvent(pExecutionFunction, &OutputLink);
 			return true;
@@ -772,6 +894,9 @@ void UDialogue::PreSave(FObjectPreSaveContext ObjectSaveContext)
 	{
 		CheckUsingStringTable();
 	}
+
+	//String table id is the path of the asset, no need to load it
+	StringTableId = StringTable.IsNull() ? NAME_None : FName(*StringTable.ToSoftObjectPath().ToString());
 }
 
 //=================================================================
@@ -1482,80 +1607,33 @@ FString GetPinId(int32 PinNum)
 //===================================================================================================
 void UDialogue::ParseLine(const FString &InString, FString &OutStrippedText, FString &OutSpeakerName, FString &OutCustomName, FString &OutExpressionName, FString &InPreviousSpeaker)
 {
-	if (!InString.Split(TEXT(": "), &OutSpeakerName, &OutStrippedText))
-	{
-		OutStrippedText = InString;
-	}
+	FDialogueLineTokens Tokens;
+	FDialogueLineTokenizer::Tokenize(InString, Tokens);
 
-	if (OutSpeakerName.Len() == 0 && InPreviousSpeaker.Len() > 0)
-	{
-		OutSpeakerName = InPreviousSpeaker;
-	}
+	//Copy out before assigning, output strings might be the same as the input
+	FString StrippedText(Tokens.Text);
+	FString ExpressionName(Tokens.Expression);
+	FString SpeakerName(Tokens.Speaker.Len() > 0 ? Tokens.Speaker : FStringView(InPreviousSpeaker));
 
-	if (OutSpeakerName.Len() > 0 && OutSpeakerName != TEXT("Player") && OutSpeakerName != TEXT("Narrator") && OutSpeakerName != "Target")
-	{
-		OutCustomName = OutSpeakerName;
-		OutSpeakerName = TEXT("Custom");
-	}
+	OutStrippedText = MoveTemp(StrippedText);
+	OutExpressionName = MoveTemp(ExpressionName);
+	OutCustomName.Reset();
 
-	if (OutSpeakerName.Len() == 0)
+	if (SpeakerName.Len() == 0)
 	{
 		OutSpeakerName = TEXT("Target");
 	}
-
-	if (OutCustomName.Len() > 0)
+	else if (SpeakerName == TEXT("Player") || SpeakerName == TEXT("Narrator") || SpeakerName == TEXT("Target"))
 	{
-		InPreviousSpeaker = OutCustomName;
-
-		//OutCustomName = FString::Printf(TEXT("(TagName=\\\"Character.Name.%s\\\")"), *CustomName); //(TagName=\"Character.Abigail\")
-
-		UE_LOG(LogTemp, Error, TEXT("Custom name value: %s"), *OutCustomName);
+		OutSpeakerName = MoveTemp(SpeakerName);
 	}
 	else
 	{
-		InPreviousSpeaker = OutSpeakerName;
-	}
-
-	if (OutStrippedText.Len() > 0 && OutStrippedText[0] == L'"' && OutStrippedText[OutStrippedText.Len() - 1] == L'"')
-	{
-		OutStrippedText.RemoveFromStart(L"\"");
-		OutStrippedText.RemoveFromEnd(L"\"");
-	}
-
-	//Remove empty spaces from end
-	while (OutStrippedText.Len() > 0 && OutStrippedText[OutStrippedText.Len() - 1] == L' ')
-	{
-		OutStrippedText.RemoveAt(OutStrippedText.Len() - 1);
+		OutCustomName = MoveTemp(SpeakerName);
+		OutSpeakerName = TEXT("Custom");
 	}
 
-	//--------------------------------------------------------------------------------------
-	// Figure out speaker
-	//--------------------------------------------------------------------------------------
-
-	//If last character is ")" then we might have an expression
-	if (OutStrippedText.Len() > 0 && OutStrippedText[OutStrippedText.Len() - 1] == L')')
-	{
-		FString NewText = OutStrippedText;
-		NewText.RemoveAt(NewText.Len() - 1);
-		NewText.Split(TEXT("("), &NewText, &OutExpressionName);
-
-		//Remove empty spaces from end
-		while (NewText.Len() > 0 && NewText[NewText.Len() - 1] == L' ')
-		{
-			NewText.RemoveAt(NewText.Len() - 1);
-		}
-
-		if (NewText.Len() > 0 && NewText[0] == L'"' && NewText[NewText.Len() - 1] == L'"')
-		{
-			NewText.RemoveFromStart(L"\"");
-			NewText.RemoveFromEnd(L"\"");
-		}
-
-		if (NewText.Len() > 0)
-		{
-			OutStrippedText = NewText;
-		}
-	}
+	InPreviousSpeaker = OutCustomName.Len() > 0 ? OutCustomName : OutSpeakerName;
 }
 
 //===================================================================================================
@@ -1631,6 +1709,139 @@ void UDialogue::GenerateNode(const FString &InString, float InDuration, int32 In
 	OutString += TEXT("End Object\r\n");
 }
 
+//===================================================================================================
+// 
+//===================================================================================================
+int32 UDialogue::GenerateNodesInGraph(const TArray<FString> &InLines, float InDuration)
+{
+	//
+	static const int XOffset = 800;
+	static const int YOffset = 420;
+
+	class UBlueprint *pBlueprint = Cast<UBlueprint>(GetClass()->ClassGeneratedBy);
+	if (!pBlueprint || pBlueprint->UbergraphPages.Num() == 0 || InLines.Num() == 0)
+		return 0;
+
+	class UEdGraph *pGraph = pBlueprint->UbergraphPages.GetData()[0];
+	if (!pGraph)
+		return 0;
+
+	UFunction *pFunction = UDialogue::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UDialogue, DialogueBox));
+	if (!pFunction)
+		return 0;
+
+	const UEnum *pExpressionEnum = StaticEnum<EDialogueExpression>();
+
+	FScopedTransaction Transaction(NSLOCTEXT("SimpleDialogue", "GenerateDialogueNodes", "Generate Dialogue Nodes"));
+	pBlueprint->Modify();
+	pGraph->Modify();
+
+	//Place new nodes below everything that is already in the graph
+	int32 iOriginY = 0;
+	for (int32 i=0; i<pGraph->Nodes.Num(); i++)
+	{
+		class UEdGraphNode *pNode = pGraph->Nodes.GetData()[i];
+		if (pNode)
+		{
+			iOriginY = FMath::Max(iOriginY, pNode->NodePosY + YOffset);
+		}
+	}
+
+	FString PreviousSpeaker = TEXT("Target");
+	FString DurationString = FString::SanitizeFloat(InDuration);
+
+	class UEdGraphPin *pPreviousThen = NULL;
+	int32 iCount = 0;
+
+	for (int32 i=0; i<InLines.Num(); i++)
+	{
+		const FString &Line = InLines.GetData()[i];
+		FStringView Trimmed = FDialogueLineTokenizer::TrimSpaces(Line);
+
+		if (Trimmed.Len() == 0)
+			continue;
+
+		//Event, choice, branch and jump lines written by the exporter
+		if (FDialogueScriptExporter::IsStructureLine(Trimmed))
+		{
+			UE_LOG(LogTemp, Display, TEXT("Skipping script structure line %d: \"%.*s\""), i + 1, Trimmed.Len(), Trimmed.GetData());
+			continue;
+		}
+
+		FStringView Unescaped = FDialogueScriptExporter::UnescapeLine(Trimmed);
+
+		FString StrippedText;
+		FString ExpressionName;
+		FString SpeakerName;
+		FString CustomName;
+		ParseLine(Unescaped.Len() != Trimmed.Len() ? FString(Unescaped) : Line, StrippedText, SpeakerName, CustomName, ExpressionName, PreviousSpeaker);
+
+		FGraphNodeCreator<UK2Node_CallFunction> NodeCreator(*pGraph);
+		UK2Node_CallFunction *pNode = NodeCreator.CreateNode(false);
+		pNode->SetFromFunction(pFunction);
+
+		if (GenerateNodesVerticallyAndNotConnected)
+		{
+			pNode->NodePosX = 0;
+			pNode->NodePosY = iOriginY + iCount * YOffset;
+		}
+		else
+		{
+			pNode->NodePosX = iCount * XOffset;
+			pNode->NodePosY = iOriginY;
+		}
+
+		NodeCreator.Finalize();
+
+		//Set defaults directly, going through the schema would mark the blueprint modified for every pin
+		if (class UEdGraphPin *pPin = pNode->FindPin(TEXT("Text"), EGPD_Input))
+		{
+			pPin->DefaultTextValue = FText::FromString(StrippedText);
+		}
+
+		if (class UEdGraphPin *pPin = pNode->FindPin(TEXT("Duration"), EGPD_Input))
+		{
+			pPin->DefaultValue = DurationString;
+		}
+
+		if (class UEdGraphPin *pPin = pNode->FindPin(TEXT("Speaker"), EGPD_Input))
+		{
+			pPin->DefaultValue = SpeakerName;
+		}
+
+		if (class UEdGraphPin *pPin = pNode->FindPin(TEXT("Expression"), EGPD_Input))
+		{
+			pPin->DefaultValue = ExpressionName.Len() > 0 && pExpressionEnum->GetIndexByNameString(ExpressionName) != INDEX_NONE ? ExpressionName : TEXT("None");
+		}
+
+		if (CustomName.Len() > 0)
+		{
+			if (class UEdGraphPin *pPin = pNode->FindPin(TEXT("InCustomName"), EGPD_Input))
+			{
+				pPin->DefaultValue = FString::Printf(TEXT("(TagName=\"Character.Name.%s\")"), *CustomName);
+			}
+		}
+
+		if (!GenerateNodesVerticallyAndNotConnected)
+		{
+			class UEdGraphPin *pExecute = pNode->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input);
+			if (pPreviousThen && pExecute)
+			{
+				pPreviousThen->MakeLinkTo(pExecute);
+			}
+
+			pPreviousThen = pNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+		}
+
+		iCount++;
+	}
+
+	pGraph->NotifyGraphChanged();
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(pBlueprint);
+
+	return iCount;
+}
+
 //===================================================================================================
 // 
 //===================================================================================================
@@ -1787,68 +1998,13 @@ bool UDialogue::ParseNodeToString(const FString& NodeString, FString& OutLine)
 	return true;
 }
 
-//===================================================================================================9
-// 
-//===================================================================================================
-void GatherTextPinsFromGraph(const TArray<class UEdGraph *> &Graphs, TArray<UEdGraphPin*> &OutPins)
-{
-	//Go through different graphs
-	for (int32 i=0; i<Graphs.Num(); i++)
-	{
-		//
-		class UEdGraph *pGraph = Graphs.GetData()[i];
-		if (!pGraph)
-			continue;
-
-		//Go through graph nodes
-		for (int32 j=0; j<pGraph->Nodes.Num(); j++)
-		{
-			//
-			class UEdGraphNode *pNode = pGraph->Nodes.GetData()[j];
-			if (!pNode)
-				continue;
-
-			//Go through pins in node
-			for (int32 k=0; k<pNode->Pins.Num(); k++)
-			{
-				//
-				class UEdGraphPin *pPin = pNode->Pins.GetData()[k];
-				if (!pPin)
-					continue;
-
-				//
-				if (pPin->LinkedTo.Num() > 0)
-					continue;
-
-				if (pPin->Direction != EEdGraphPinDirection::EGPD_Input)
-					continue;
-
-				//Make sure correct type
-				static const FName Name_Text = TEXT("text");
-				if (pPin->PinType.PinCategory != Name_Text)
-				{
-					continue;
-				}
-
-				OutPins.Add(pPin);
-			}
-		}
-	}
-}
-
 //===================================================================================================
 // 
 //===================================================================================================
 void GatherAllTextPins(class UObject *InObject, TArray<UEdGraphPin*> &OutPins)
 {
 	//If object, then check if blueprint object
-	class UBlueprint *pBlueprint = Cast<UBlueprint>(InObject->GetClass()->ClassGeneratedBy);
-	if (pBlueprint)
-	{
-		GatherTextPinsFromGraph( pBlueprint->UbergraphPages, OutPins);
-		GatherTextPinsFromGraph( pBlueprint->FunctionGraphs, OutPins);
-		GatherTextPinsFromGraph( pBlueprint->MacroGraphs, OutPins);
-	}
+	FDialogueTextPinIndex::GatherTextPins(Cast<UBlueprint>(InObject->GetClass()->ClassGeneratedBy), OutPins);
 }
 
 //===================================================================================================
@@ -1858,101 +2014,26 @@ bool UDialogue::GatherAllTexts(TSubclassOf<class UDialogue> DialogueScript, TArr
 {
 	Texts.Reset();
 
-	TArray<UEdGraphPin*> Pins;
-
 	//If object, then check if blueprint object
-	class UBlueprint* pBlueprint = Cast<UBlueprint>(DialogueScript->ClassGeneratedBy);
+	class UBlueprint* pBlueprint = DialogueScript != NULL ? Cast<UBlueprint>(DialogueScript->ClassGeneratedBy) : NULL;
 	if (pBlueprint)
 	{
-		GatherTextPinsFromGraph(pBlueprint->UbergraphPages, Pins);
-		GatherTextPinsFromGraph(pBlueprint->FunctionGraphs, Pins);
-		GatherTextPinsFromGraph(pBlueprint->MacroGraphs, Pins);
-	}
-
-	for (int32 i=0; i<Pins.Num(); i++)
-	{
-		Texts.Add(Pins.GetData()[i]->DefaultTextValue);
+		Texts = FDialogueTextPinIndex::Get().GetTexts(pBlueprint);
 	}
 
 	return Texts.Num() > 0;
 }
 
-//===================================================================================================9
-// 
-//===================================================================================================
-class UEdGraphPin *FindTextPinInGraph(const TArray<class UEdGraph*>& Graphs, const FString &Text)
-{
-	//Go through different graphs
-	for (int32 i = 0; i < Graphs.Num(); i++)
-	{
-		//
-		class UEdGraph* pGraph = Graphs.GetData()[i];
-		if (!pGraph)
-			continue;
-
-		//Go through graph nodes
-		for (int32 j = 0; j < pGraph->Nodes.Num(); j++)
-		{
-			//
-			class UEdGraphNode* pNode = pGraph->Nodes.GetData()[j];
-			if (!pNode)
-				continue;
-
-			//Go through pins in node
-			for (int32 k = 0; k < pNode->Pins.Num(); k++)
-			{
-				//
-				class UEdGraphPin* pPin = pNode->Pins.GetData()[k];
-				if (!pPin)
-					continue;
-
-				//
-				if (pPin->LinkedTo.Num() > 0)
-					continue;
-
-				if (pPin->Direction != EEdGraphPinDirection::EGPD_Input)
-					continue;
-
-				//Make sure correct type
-				static const FName Name_Text = TEXT("text");
-				if (pPin->PinType.PinCategory != Name_Text)
-				{
-					continue;
-				}
-
-				if (pPin->DefaultTextValue.ToString().Equals(Text))
-					return pPin;
-			}
-		}
-	}
-
-	return NULL;
-}
-
 //===================================================================================================
 // 
 //===================================================================================================
 class UEdGraphPin *UDialogue::FindPinWithText(TSubclassOf<class UDialogue> DialogueScript, const FText &Text)
 {
 	//If object, then check if blueprint object
-	class UBlueprint* pBlueprint = Cast<UBlueprint>(DialogueScript->ClassGeneratedBy);
+	class UBlueprint* pBlueprint = DialogueScript != NULL ? Cast<UBlueprint>(DialogueScript->ClassGeneratedBy) : NULL;
 	if (pBlueprint)
 	{
-		FString String = Text.ToString();
-
-		class UEdGraphPin *pPin;
-
-		pPin = FindTextPinInGraph(pBlueprint->UbergraphPages, String);
-		if (pPin)
-			return pPin;
-
-		pPin = FindTextPinInGraph(pBlueprint->FunctionGraphs, String);
-		if (pPin)
-			return pPin;
-
-		pPin = FindTextPinInGraph(pBlueprint->MacroGraphs, String);
-		if (pPin)
-			return pPin;
+		return FDialogueTextPinIndex::Get().FindPin(pBlueprint, Text);
 	}
 
 	return NULL;
@@ -2111,6 +2192,40 @@ void UDialogue::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEve
 		GenerateNodesFromTextsAndCopyToClipboard = false;
 	}
 
+	if (GenerateNodesFromTextsIntoGraph)
+	{
+		GenerateNodesFromTextsIntoGraph = false;
+
+		int32 iCount = GenerateNodesInGraph(ClipboardTexts, GenerateDefaultDuration);
+		UE_LOG(LogTemp, Display, TEXT("Generated %d dialogue nodes from %d texts"), iCount, ClipboardTexts.Num());
+	}
+
+	if (GenerateNodesFromScriptFile)
+	{
+		GenerateNodesFromScriptFile = false;
+
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(Lines, *ImportScriptFile.FilePath))
+		{
+			int32 iCount = GenerateNodesInGraph(Lines, GenerateDefaultDuration);
+			UE_LOG(LogTemp, Display, TEXT("Generated %d dialogue nodes from \"%s\""), iCount, *ImportScriptFile.FilePath);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to read script file \"%s\""), *ImportScriptFile.FilePath);
+		}
+	}
+
+	if (ExportNodesToScriptFile)
+	{
+		ExportNodesToScriptFile = false;
+
+		if (!FDialogueScriptExporter::ExportToFile(Cast<UBlueprint>(GetClass()->ClassGeneratedBy), ExportScriptFile.FilePath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to write script file \"%s\""), *ExportScriptFile.FilePath);
+		}
+	}
+
 	if (ResetTimeInAllNodes)
 	{
 		ResetTimeInAllNodes = false;
@@ -0,0 +1,107 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueContextFeed.h"
+#include "HAL/IConsoleManager.h"
+
+#if SIMPLEDIALOGUE_CONTEXT_FEED
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void PushFeedChanges(FDialogueContextFeed &Feed, int32 InFirst, int32 InCount)
+{
+	for (int32 i=0; i<InCount; i++)
+	{
+		FDialogueContextChange Change;
+		Change.NewValue = InFirst + i;
+		Feed.Push(Change);
+	}
+}
+
+//==============================================================================================================
+// Values read must be InFirst, InFirst + 1, ...
+//==============================================================================================================
+static bool CheckFeedRead(const TCHAR *InName, const FDialogueContextFeed &Feed, uint64 &InOutCursor, bool bInComplete, int32 InFirst, int32 InCount)
+{
+	TArray<FDialogueContextChange> Changes;
+	bool bComplete = Feed.Read(InOutCursor, Changes);
+
+	bool bPassed = bComplete == bInComplete && Changes.Num() == InCount && InOutCursor == Feed.GetHead();
+	for (int32 i=0; bPassed && i<Changes.Num(); i++)
+	{
+		bPassed = Changes.GetData()[i].NewValue == InFirst + i;
+	}
+
+	if (!bPassed)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Context feed check \"%s\" failed: complete %d, %d changes, first %d"), InName, bComplete, Changes.Num(), Changes.Num() > 0 ? Changes.GetData()[0].NewValue : -1);
+	}
+
+	return bPassed;
+}
+
+//==============================================================================================================
+// Readers around Invalidate and wrapping, before and after the buffer is full
+//==============================================================================================================
+static void CheckContextFeed(const TArray<FString> &Args)
+{
+	const int32 Capacity = FDialogueContextFeed::Capacity;
+	int32 iFailed = 0;
+
+	//Invalidate before the buffer is full
+	{
+		FDialogueContextFeed Feed;
+		PushFeedChanges(Feed, 0, 3);
+
+		uint64 UpToDate = 0;
+		uint64 Behind = 1;
+		iFailed += !CheckFeedRead(TEXT("Read before invalidate"), Feed, UpToDate, true, 0, 3);
+
+		Feed.Invalidate();
+		iFailed += !CheckFeedRead(TEXT("Up to date reader after invalidate"), Feed, UpToDate, false, 0, 0);
+		iFailed += !CheckFeedRead(TEXT("Behind reader after invalidate"), Feed, Behind, false, 0, 0);
+
+		PushFeedChanges(Feed, 10, 2);
+		iFailed += !CheckFeedRead(TEXT("Push after invalidate"), Feed, UpToDate, true, 10, 2);
+
+		uint64 Stale = 2;
+		iFailed += !CheckFeedRead(TEXT("Cursor from before invalidate"), Feed, Stale, false, 10, 2);
+	}
+
+	//Wrapped buffer, then invalidated and filled past the capacity again
+	{
+		FDialogueContextFeed Feed;
+		PushFeedChanges(Feed, 0, Capacity + 5);
+
+		uint64 Cursor = 0;
+		iFailed += !CheckFeedRead(TEXT("Reader fell behind"), Feed, Cursor, false, 5, Capacity);
+
+		Feed.Invalidate();
+		PushFeedChanges(Feed, 0, Capacity + 7);
+		iFailed += !CheckFeedRead(TEXT("Wrapped after invalidate"), Feed, Cursor, false, 7, Capacity);
+
+		PushFeedChanges(Feed, 100, 1);
+		iFailed += !CheckFeedRead(TEXT("One more"), Feed, Cursor, true, 100, 1);
+	}
+
+	if (iFailed == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Context feed checks passed"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("%d context feed checks failed"), iFailed);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand CheckContextFeedCommand(
+	TEXT("SimpleDialogue.ContextFeed.Check"),
+	TEXT("Runs readers against FDialogueContextFeed around Invalidate and wrapping, and logs any that read the wrong changes."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&CheckContextFeed));
+
+#endif //SIMPLEDIALOGUE_CONTEXT_FEED
@@ -0,0 +1,70 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueContextTagCatalogue.h"
+#include "Dialogue/DialogueSettings.h"
+#include "GameplayTagsManager.h"
+#include "GameplayTagsModule.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueContextTagCatalogue &FDialogueContextTagCatalogue::Get()
+{
+	static FDialogueContextTagCatalogue Catalogue;
+	return Catalogue;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueContextTagCatalogue::Invalidate()
+{
+	bIsDirty = true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueContextTagCatalogue::Build()
+{
+	bIsDirty = false;
+	Serial++;
+
+	if (!bIsBound)
+	{
+		bIsBound = true;
+		IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(this, &FDialogueContextTagCatalogue::Invalidate);
+	}
+
+	Tags.Reset();
+	TagToId.Reset();
+
+	const UDialogueSettings *pSettings = GetDefault<UDialogueSettings>();
+	UGameplayTagsManager &Manager = UGameplayTagsManager::Get();
+
+	//Roots can overlap, container takes care of duplicates
+	FGameplayTagContainer Container;
+	for (int32 i=0; i<pSettings->ContextRoots.Num(); i++)
+	{
+		FGameplayTag Root = FGameplayTag::RequestGameplayTag(pSettings->ContextRoots.GetData()[i], false);
+		if (!Root.IsValid())
+			continue;
+
+		Container.AppendTags(Manager.RequestGameplayTagChildren(Root));
+	}
+
+	Container.GetGameplayTagArray(Tags);
+
+	Tags.Sort([](const FGameplayTag &A, const FGameplayTag &B)
+	{
+		return A.GetTagName().Compare(B.GetTagName()) < 0;
+	});
+
+	TagToId.Reserve(Tags.Num());
+	for (int32 i=0; i<Tags.Num(); i++)
+	{
+		TagToId.Add(Tags.GetData()[i], i);
+	}
+}
@@ -0,0 +1,165 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueLineDurations.h"
+#include "Internationalization/BreakIterator.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "Internationalization/TextInspector.h"
+#include "UObject/ObjectSaveContext.h"
+
+#if WITH_EDITOR
+UDialogueLineDurations::FOnRebuild UDialogueLineDurations::OnRebuild;
+UDialogueLineDurations::FOnRebuild UDialogueLineDurations::OnVerify;
+#endif //
+
+//==============================================================================================================
+// Scripts written without spaces between words
+//==============================================================================================================
+static bool IsWideGlyph(uint32 InCodepoint)
+{
+	return (InCodepoint >= 0x3040 && InCodepoint <= 0x30FF)		//Hiragana, katakana
+		|| (InCodepoint >= 0x3400 && InCodepoint <= 0x4DBF)		//CJK extension A
+		|| (InCodepoint >= 0x4E00 && InCodepoint <= 0x9FFF)		//CJK unified ideographs
+		|| (InCodepoint >= 0xAC00 && InCodepoint <= 0xD7AF)		//Hangul syllables
+		|| (InCodepoint >= 0xF900 && InCodepoint <= 0xFAFF)		//CJK compatibility ideographs
+		|| (InCodepoint >= 0x20000 && InCodepoint <= 0x2FA1F);	//CJK extensions B and later
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+float UDialogueLineDurations::CountLetters(const FString &InString, const FString &InCulture) const
+{
+	TSharedRef<IBreakIterator> Graphemes = FBreakIterator::CreateCharacterBoundaryIterator();
+	Graphemes->SetString(InString);
+
+	float flLetters = 0.0f;
+
+	int32 iStart = 0;
+	for (int32 iEnd = Graphemes->MoveToNext(); iEnd != INDEX_NONE; iEnd = Graphemes->MoveToNext())
+	{
+		uint32 iCodepoint = InString.GetCharArray().GetData()[iStart];
+		if (StringConv::IsHighSurrogate(iCodepoint) && iStart + 1 < iEnd)
+		{
+			iCodepoint = StringConv::EncodeSurrogate((uint16)iCodepoint, (uint16)InString.GetCharArray().GetData()[iStart + 1]);
+		}
+
+		flLetters += IsWideGlyph(iCodepoint) ? WideGlyphLetters : 1.0f;
+		iStart = iEnd;
+	}
+
+	const float *pScale = CultureLetterScale.Find(InCulture);
+	if (!pScale)
+	{
+		int32 iSeparator = INDEX_NONE;
+		if (InCulture.FindChar(TEXT('-'), iSeparator))
+		{
+			pScale = CultureLetterScale.Find(InCulture.Left(iSeparator));
+		}
+	}
+
+	return pScale ? flLetters * *pScale : flLetters;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+int32 UDialogueLineDurations::FindCulture() const
+{
+	FCultureRef Language = FInternationalization::Get().GetCurrentLanguage();
+	if (CachedLanguage == Language)
+		return CachedCulture;
+
+	CachedLanguage = Language;
+	CachedCulture = INDEX_NONE;
+
+	//en-US falls back to en like the localization data does
+	const TArray<FString> Names = Language->GetPrioritizedParentCultureNames();
+	for (int32 i=0; i<Names.Num() && CachedCulture == INDEX_NONE; i++)
+	{
+		for (int32 j=0; j<Cultures.Num(); j++)
+		{
+			if (Cultures.GetData()[j].Culture == Names.GetData()[i])
+			{
+				CachedCulture = j;
+				break;
+			}
+		}
+	}
+
+	return CachedCulture;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueLineDurations::ResetCaches()
+{
+	CachedLanguage.Reset();
+	CachedCulture = INDEX_NONE;
+	LineIndices.Reset();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool UDialogueLineDurations::FindLetters(const FText &InText, float &OutLetters) const
+{
+	FName TableId;
+	FString Key;
+	if (!FTextInspector::GetTableIdAndKey(InText, TableId, Key))
+		return false;
+
+	const int32 iCulture = FindCulture();
+	if (iCulture == INDEX_NONE)
+		return false;
+
+	if (LineIndices.Num() == 0 && Lines.Num() > 0)
+	{
+		LineIndices.Reserve(Lines.Num());
+		for (int32 i=0; i<Lines.Num(); i++)
+		{
+			LineIndices.Add(TPair<FName, FName>(Lines.GetData()[i].TableId, Lines.GetData()[i].Key), i);
+		}
+	}
+
+	//Every key in the durations is already a name, a key that isn't can't be found
+	const FName KeyName(*Key, FNAME_Find);
+	if (KeyName.IsNone())
+		return false;
+
+	const int32 *pIndex = LineIndices.Find(TPair<FName, FName>(TableId, KeyName));
+	if (!pIndex)
+		return false;
+
+	const FDialogueCultureLineDurations &Durations = Cultures.GetData()[iCulture];
+	if (!Durations.Letters.IsValidIndex(*pIndex))
+		return false;
+
+	OutLetters = Durations.Letters.GetData()[*pIndex] / LetterScale;
+	return true;
+}
+
+#if WITH_EDITOR
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueLineDurations::VerifySourceTables()
+{
+	OnVerify.Broadcast(this);
+	ResetCaches();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueLineDurations::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	OnRebuild.Broadcast(this);
+	ResetCaches();
+
+	Super::PreSave(ObjectSaveContext);
+}
+#endif //WITH_EDITOR
@@ -0,0 +1,111 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueLineTokenizer.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FStringView FDialogueLineTokenizer::TrimSpaces(FStringView InView)
+{
+	int32 iStart = 0;
+	int32 iEnd = InView.Len();
+
+	while (iStart < iEnd && (InView[iStart] == TEXT(' ') || InView[iStart] == TEXT('\t')))
+	{
+		iStart++;
+	}
+
+	while (iEnd > iStart && (InView[iEnd - 1] == TEXT(' ') || InView[iEnd - 1] == TEXT('\t') || InView[iEnd - 1] == TEXT('\r') || InView[iEnd - 1] == TEXT('\n')))
+	{
+		iEnd--;
+	}
+
+	return InView.Mid(iStart, iEnd - iStart);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FStringView FDialogueLineTokenizer::StripQuotes(FStringView InView)
+{
+	if (InView.Len() >= 2 && InView[0] == TEXT('"') && InView[InView.Len() - 1] == TEXT('"'))
+	{
+		return InView.Mid(1, InView.Len() - 2);
+	}
+
+	return InView;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueLineTokenizer::Tokenize(FStringView InLine, FDialogueLineTokens &OutTokens)
+{
+	OutTokens.Speaker = FStringView();
+	OutTokens.Text = FStringView();
+	OutTokens.Expression = FStringView();
+
+	FStringView Line = InLine;
+
+	//--------------------------------------------------------------------------------------
+	// Speaker. First ": " before any quote
+	//--------------------------------------------------------------------------------------
+	for (int32 i=0; i + 1 < Line.Len(); i++)
+	{
+		if (Line[i] == TEXT('"'))
+			break;
+
+		if (Line[i] == TEXT(':') && Line[i + 1] == TEXT(' '))
+		{
+			OutTokens.Speaker = TrimSpaces(Line.Left(i));
+			Line = Line.RightChop(i + 2);
+			break;
+		}
+	}
+
+	FStringView Body = TrimSpaces(Line);
+
+	//--------------------------------------------------------------------------------------
+	// Expression. Trailing "(...)" outside of quotes
+	//--------------------------------------------------------------------------------------
+	if (Body.Len() > 0 && Body[Body.Len() - 1] == TEXT(')'))
+	{
+		//Find where quotes end so that parenthesis inside the quoted text are left alone
+		int32 iQuoteEnd = INDEX_NONE;
+		if (Body[0] == TEXT('"'))
+		{
+			for (int32 i=Body.Len() - 1; i > 0; i--)
+			{
+				if (Body[i] == TEXT('"'))
+				{
+					iQuoteEnd = i;
+					break;
+				}
+			}
+		}
+
+		int32 iOpen = INDEX_NONE;
+		for (int32 i=Body.Len() - 2; i > iQuoteEnd; i--)
+		{
+			if (Body[i] == TEXT('('))
+			{
+				iOpen = i;
+				break;
+			}
+		}
+
+		if (iOpen != INDEX_NONE)
+		{
+			FStringView Before = TrimSpaces(Body.Left(iOpen));
+			if (Before.Len() > 0)
+			{
+				OutTokens.Expression = TrimSpaces(Body.Mid(iOpen + 1, Body.Len() - iOpen - 2));
+				Body = Before;
+			}
+		}
+	}
+
+	OutTokens.Text = StripQuotes(Body);
+}
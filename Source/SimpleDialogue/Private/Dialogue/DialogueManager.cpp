@@ -4,6 +4,10 @@
 
 #include "Dialogue/DialogueManager.h"
 #include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueStats.h"
+#include "Dialogue/DialogueMemory.h"
+#include "Dialogue/DialogueLineDurations.h"
+#include "Algo/Sort.h"
 #include "Internationalization/TextFormatter.h"
 #include "GameFramework/Actor.h"
 #include "Kismet/GameplayStatics.h"
@@ -15,6 +19,7 @@
 #endif //WITH_EDITOR
 #include "Dialogue/OneLineDialogue.h"
 #include "GameplayTagsManager.h"
+#include "Dialogue/DialogueContextTagCatalogue.h"
 
 //==============================================================================================================
 //
@@ -25,6 +30,16 @@ UDialogueManager::UDialogueManager()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
+
+	TextFormatter.SetContextResolver([this](const FGameplayTag &InTag, int32 &OutValue)
+	{
+		const int32 *pValue = GlobalContext.Find(InTag);
+		if (!pValue)
+			return false;
+
+		OutValue = *pValue;
+		return true;
+	});
 }
 
 //==============================================================================================================
@@ -100,15 +115,7 @@ bool FContextAndValue::RemoveContext(class UDialogueManager* InManager, const FG
 //==============================================================================================================
 void UDialogueManager::GetAllContextTags(TArray<FGameplayTag>& OutTags)
 {
-	FGameplayTag ContextTag = FGameplayTag::RequestGameplayTag(TEXT("Context"), false);
-	FGameplayTagContainer Container = UGameplayTagsManager::Get().RequestGameplayTagChildren(ContextTag);
-	Container.GetGameplayTagArray(OutTags);
-
-	FGameplayTag DocksTag = FGameplayTag::RequestGameplayTag(TEXT("Docks"), false);
-	FGameplayTagContainer DocksContainer = UGameplayTagsManager::Get().RequestGameplayTagChildren(DocksTag);
-	TArray<FGameplayTag> OutDocksTags;
-	DocksContainer.GetGameplayTagArray(OutDocksTags);
-	OutTags.Append(OutDocksTags);
+	OutTags = FDialogueContextTagCatalogue::Get().GetTags();
 }
 
 //==============================================================================================================
@@ -119,6 +126,16 @@ void UDialogueManager::Initialize(class APlayerController *InController)
 	PlayerController = InController;
 	QueueDialogueUpdate();
 
+	LoadedLineDurations = LineDurations.LoadSynchronous();
+
+#if WITH_EDITOR
+	//String tables may have been edited after the durations were saved
+	if (LoadedLineDurations)
+	{
+		LoadedLineDurations->VerifySourceTables();
+	}
+#endif //
+
 	for (int32 i=Context.Num()-1; i>=0; i--)
 	{
 		AddContext(Context.GetData()[i].Tag, Context.GetData()[i].ActorTag, Context.GetData()[i].Value);
@@ -151,6 +168,20 @@ class AActor *UDialogueManager::GetDialogueTarget() const
 	return NULL;
 }
 
+//==============================================================================================================
+//
+//==============================================================================================================
+float UDialogueManager::GetTextDuration(const FText &InText) const
+{
+	float flLetters = 0.0f;
+	if (!LoadedLineDurations || !LoadedLineDurations->FindLetters(InText, flLetters))
+	{
+		flLetters = InText.ToString().Len();
+	}
+
+	return FMath::Max(AdditionalTextTime + (TimePerLetter * flLetters), MinimumTextTime);
+}
+
 //==============================================================================================================
 //
 //==============================================================================================================
@@ -169,31 +200,65 @@ int32 UDialogueManager::GetMaxChoices() const
 //==============================================================================================================
 void UDialogueManager::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
+	SCOPE_CYCLE_COUNTER(STAT_DialogueManagerTick);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	FDialogueStats::Update();
+
 	if (Dialogue)
 		Dialogue->Update(DeltaTime);
 
-	if (ShouldUpdateDialogue)
+	class AActor *pPrevious = PreviousSpeaker.Get();
+	class AActor *pCurrent = NULL;
+	EDialogueExpression NewExpression = EDialogueExpression::None;
+
+	//Speaker changes go with the same update
+	if (ShouldUpdateSpeaker)
 	{
-		OnDialogueUpdated.Broadcast();
-		ShouldUpdateDialogue = false;
+		pCurrent = InDialogue() && !HasDialogueOptions() ? Dialogue->GetActor() : NULL;
+		NewExpression = InDialogue() ? Dialogue->GetExpression() : EDialogueExpression::None;
+
+		if (pPrevious != pCurrent)
+		{
+			DirtyFlags |= EDialogueDirty::Speaker;
+		}
+
+		if (IsValid(pCurrent) && (pPrevious != pCurrent || NewExpression != PreviousExpression))
+		{
+			DirtyFlags |= EDialogueDirty::Expression;
+		}
+	}
+
+	if (DirtyFlags != EDialogueDirty::None)
+	{
+		const EDialogueDirty Flags = DirtyFlags;
+		DirtyFlags = EDialogueDirty::None;
+		BroadcastDialogueUpdate(Flags);
 	}
 
 	if (ShouldUpdateSpeaker)
 	{
-		class AActor *pPrevious = PreviousSpeaker.Get();
-		class AActor *pCurrent = InDialogue() && !HasDialogueOptions() ? Dialogue->GetActor() : NULL;
-		EDialogueExpression NewExpression = InDialogue() ? Dialogue->GetExpression() : EDialogueExpression::None;
-		
 		if (pPrevious != pCurrent)
 		{
-			OnSpeakerChanged.Broadcast(pPrevious, pCurrent);
+			OnSpeakerChangedNative.Broadcast(pPrevious, pCurrent);
+
+			if (OnSpeakerChanged.IsBound())
+			{
+				SIMPLEDIALOGUE_BROADCAST_SCOPE(OnSpeakerChanged);
+				OnSpeakerChanged.Broadcast(pPrevious, pCurrent);
+			}
 		}
 
 		if (IsValid(pCurrent) && (pPrevious != pCurrent || NewExpression != PreviousExpression))
 		{
-			OnExpressionChanged.Broadcast(pCurrent, NewExpression);
+			OnExpressionChangedNative.Broadcast(pCurrent, NewExpression);
+
+			if (OnExpressionChanged.IsBound())
+			{
+				SIMPLEDIALOGUE_BROADCAST_SCOPE(OnExpressionChanged);
+				OnExpressionChanged.Broadcast(pCurrent, NewExpression);
+			}
 		}
 
 		PreviousSpeaker = pCurrent;
@@ -214,6 +279,14 @@ void UDialogueManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	ClearDialogue();
 
+#if STATS
+	DEC_MEMORY_STAT_BY(STAT_DialogueContextMemory, ContextStatSize);
+	ContextStatSize = 0;
+#endif //
+
+	TextCache.Reset();
+	TextFormatter.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -233,7 +306,14 @@ void UDialogueManager::SetDialogueHoveredAsset(class UDataAsset *InAsset)
 	if (HoveredAsset != InAsset)
 	{
 		HoveredAsset = InAsset;
-		OnDialogueAssetHovered.Broadcast(HoveredAsset);
+
+		OnDialogueAssetHoveredNative.Broadcast(HoveredAsset);
+
+		if (OnDialogueAssetHovered.IsBound())
+		{
+			SIMPLEDIALOGUE_BROADCAST_SCOPE(OnDialogueAssetHovered);
+			OnDialogueAssetHovered.Broadcast(HoveredAsset);
+		}
 	}
 }
 
@@ -249,7 +329,11 @@ void UDialogueManager::ClearDialogue()
 		ShouldUpdateSpeaker = true;
 
 #if WITH_EDITOR
-		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(Dialogue);
+		//No editor in commandlets and simulations
+		if (GEditor)
+		{
+			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(Dialogue);
+		}
 #endif
 
 		Dialogue->Deactivate();
@@ -271,6 +355,8 @@ bool UDialogueManager::SkipDialogue(bool All)
 		return false;
 	}
 
+	RecordTelemetry(EDialogueTelemetryEvent::Skip, NAME_None, All ? 1 : 0);
+
 	if (All)
 	{
 		while (Dialogue && Dialogue->HasDialogue() && !Dialogue->HasChoices())
@@ -416,21 +502,34 @@ bool UDialogueManager::IsActorInvolved(const class AActor* const InActor) const
 //=================================================================
 void UDialogueManager::SpeakDialogueLatent(TSoftClassPtr<UDialogue> NewDialogue, class AActor *InPlayer, class AActor *InActor, FGameplayTag InSpeakContext, bool InWaitForActivation, FLatentActionInfo LatentInfo)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(SpeakDialogue);
+
 	if (!IsValid(InPlayer))
 	{
 		return;
 	}
 
-	TSubclassOf<UDialogue> DialogueClass = UDialogue::LoadDialogue(NewDialogue);
+	TSubclassOf<UDialogue> DialogueClass;
+	{
+		SIMPLEDIALOGUE_TRACE_SCOPE(SpeakDialogue_Load);
+		DialogueClass = UDialogue::LoadDialogue(NewDialogue);
+	}
+
 	if (!DialogueClass)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Invalid dialogue class \"%s\""), *NewDialogue.ToString());
 		return;
 	}
 
+	SIMPLEDIALOGUE_TRACE(Speak, DialogueClass.Get(), InSpeakContext, InWaitForActivation);
+
 	ClearDialogue();
 
-	Dialogue = NewObject<UDialogue>(this, DialogueClass);
+	{
+		SIMPLEDIALOGUE_TRACE_SCOPE(SpeakDialogue_NewObject);
+		Dialogue = NewObject<UDialogue>(this, DialogueClass);
+	}
+
 	if (Dialogue)
 	{
 		//UE_LOG(LogTemp, Error, TEXT("Starting dialogue..."));
@@ -445,7 +544,9 @@ void UDialogueManager::SpeakDialogueLatent(TSoftClassPtr<UDialogue> NewDialogue,
 		}
 		else
 		{
+			SIMPLEDIALOGUE_TRACE_SCOPE(SpeakDialogue_Activate);
 			WaitingForActivation = false;
+			TextCache.Warm(Dialogue->GetStringTableId());
 			Dialogue->Activate();
 		}
 
@@ -466,7 +567,9 @@ void UDialogueManager::ActivateDialogue()
 {
 	if (Dialogue && WaitingForActivation)
 	{
+		SIMPLEDIALOGUE_TRACE_SCOPE(SpeakDialogue_Activate);
 		WaitingForActivation = false;
+		TextCache.Warm(Dialogue->GetStringTableId());
 		Dialogue->Activate();
 	}
 }
@@ -477,7 +580,48 @@ void UDialogueManager::ActivateDialogue()
 void UDialogueManager::TogglePause()
 {
 	if (Dialogue)
+	{
 		Dialogue->SetPaused(!Dialogue->IsPaused());
+		MarkDialogueDirty(EDialogueDirty::Pause);
+	}
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::BroadcastDialogueUpdate(EDialogueDirty InFlags)
+{
+	//Listeners can cause another update while this one is broadcast
+	const EDialogueDirty PreviousFlags = UpdateFlags;
+	UpdateFlags = InFlags;
+
+	OnDialogueUpdatedNative.Broadcast(InFlags);
+
+	//Blueprint listeners go through ProcessEvent, skip the scope too when there are none
+	if (OnDialogueUpdated.IsBound())
+	{
+		SIMPLEDIALOGUE_BROADCAST_SCOPE(OnDialogueUpdated);
+		OnDialogueUpdated.Broadcast();
+	}
+
+	UpdateFlags = PreviousFlags;
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::CallWithUpdateFlags(EDialogueDirty InFlags, TFunctionRef<void()> InFunction)
+{
+	TGuardValue<EDialogueDirty> Guard(UpdateFlags, InFlags);
+	InFunction();
+}
+
+//=================================================================
+// 
+//=================================================================
+bool UDialogueManager::WasUpdated(EDialogueDirty InFlag) const
+{
+	return EnumHasAnyFlags(UpdateFlags, InFlag);
 }
 
 //=================================================================
@@ -541,28 +685,169 @@ FText UDialogueManager::GetText() const
 {
 	if (Dialogue)
 	{
-		//UDialogueManager *pController = const_cast<UDialogueManager*>(this);
+		//Key bindings like {Attack} and {Use} are set by the game with SetTextArgument
+		return TextFormatter.Format(Dialogue->GetText());
+	}
+
+	return FText::GetEmpty();
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::SetTextArgument(const FString &InName, FText InValue)
+{
+	if (TextFormatter.SetArgument(InName, FFormatArgumentValue(InValue)))
+	{
+		OnTextArgumentsChanged();
+	}
+}
 
-		//TArray<FFormatArgumentData> InArgs;
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::SetTextArgumentNumber(const FString &InName, int32 InValue)
+{
+	if (TextFormatter.SetArgument(InName, FFormatArgumentValue(InValue)))
+	{
+		OnTextArgumentsChanged();
+	}
+}
 
-		/*
-		FFormatArgumentData attack;
-		attack.ArgumentName = TEXT("Attack");
-		attack.ArgumentValue = GetKeyDisplayName( pController->FindActionKey( TEXT("Attack"), pController->GetUsingGamepad() ) );
-		attack.ArgumentValueType = EFormatArgumentType::Text;
-		InArgs.Add(attack);
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::RemoveTextArgument(const FString &InName)
+{
+	if (TextFormatter.RemoveArgument(InName))
+	{
+		OnTextArgumentsChanged();
+	}
+}
 
-		FFormatArgumentData use;
-		use.ArgumentName = TEXT("Use");
-		use.ArgumentValue = GetKeyDisplayName( pController->FindActionKey( TEXT("Use"), pController->GetUsingGamepad() ) );
-		use.ArgumentValueType = EFormatArgumentType::Text;
-		InArgs.Add(use);
-		*/
+//=================================================================
+// 
+//=================================================================
+const FString &UDialogueManager::GetDisplayString() const
+{
+	return TextCache.GetDisplayString(GetText());
+}
+
+//=================================================================
+// 
+//=================================================================
+FVector2D UDialogueManager::GetTextSize(const FSlateFontInfo &InFont) const
+{
+	return TextCache.GetSize(GetText(), InFont);
+}
 
-		return Dialogue->GetText(); //return FTextFormatter::Format(Dialogue->GetText(), MoveTemp(InArgs), false, false);
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::GetContextMemoryUsage(TArray<FDialogueContextMemoryUsage> &OutUsage) const
+{
+	OutUsage.Reset(ActorContext.Num() + 1);
+
+	FDialogueContextMemoryUsage &Global = OutUsage.AddDefaulted_GetRef();
+	Global.Num = GlobalContext.Num();
+	Global.Bytes = GlobalContext.GetAllocatedSize();
+
+	for (auto It = ActorContext.CreateConstIterator(); It; ++It)
+	{
+		FDialogueContextMemoryUsage &Usage = OutUsage.AddDefaulted_GetRef();
+		Usage.ActorTag = It.Key();
+		Usage.Num = It.Value().Values.Num();
+		Usage.Bytes = It.Value().Values.GetAllocatedSize();
 	}
 
-	return FText::GetEmpty();
+	//Outer map slots belong to the actors, split evenly
+	if (ActorContext.Num() > 0)
+	{
+		const SIZE_T OuterBytes = ActorContext.GetAllocatedSize() / ActorContext.Num();
+		for (int32 i=1; i<OutUsage.Num(); i++)
+		{
+			OutUsage.GetData()[i].Bytes += OuterBytes;
+		}
+	}
+
+	Algo::Sort(MakeArrayView(OutUsage.GetData() + 1, OutUsage.Num() - 1), [](const FDialogueContextMemoryUsage &A, const FDialogueContextMemoryUsage &B)
+	{
+		return A.Bytes > B.Bytes;
+	});
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::GetResourceSizeEx(FResourceSizeEx &CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	SIZE_T Bytes = GlobalContext.GetAllocatedSize() + ActorContext.GetAllocatedSize();
+	for (auto It = ActorContext.CreateConstIterator(); It; ++It)
+	{
+		Bytes += It.Value().Values.GetAllocatedSize();
+	}
+
+	Bytes += TextCache.GetAllocatedSize() + TextFormatter.GetAllocatedSize();
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Bytes);
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::RecordTelemetry(EDialogueTelemetryEvent InType, FName InKey, int32 InIndex) const
+{
+	if (!FDialogueTelemetry::IsRecording())
+		return;
+
+	FDialogueTelemetryRecord Record;
+	Record.Type = InType;
+	Record.Key = InKey;
+	Record.Index = InIndex;
+	SendTelemetry(Record);
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::NotifyContextObservers(EDialogueContextChange InType, const FGameplayTag &InTag, const FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue)
+{
+#if SIMPLEDIALOGUE_CONTEXT_FEED
+	FDialogueContextChange Change;
+	Change.Tag = InTag;
+	Change.ActorTag = InActorTag;
+	Change.OldValue = InOldValue;
+	Change.NewValue = InNewValue;
+	Change.Time = FPlatformTime::Seconds();
+	Change.Type = InType;
+	ContextFeed.Push(Change);
+#endif //
+
+	SIMPLEDIALOGUE_TRACE(ContextChange, (uint8)InType, InTag, InActorTag, InOldValue, InNewValue);
+
+	if (FDialogueTelemetry::IsRecording())
+	{
+		FDialogueTelemetryRecord Record;
+		Record.Type = EDialogueTelemetryEvent::ContextChange;
+		Record.Index = (int32)InType;
+		Record.Tag = InTag;
+		Record.ActorTag = InActorTag;
+		Record.OldValue = InOldValue;
+		Record.NewValue = InNewValue;
+		SendTelemetry(Record);
+	}
+}
+
+//=================================================================
+// 
+//=================================================================
+void UDialogueManager::SendTelemetry(FDialogueTelemetryRecord &InOutRecord) const
+{
+	InOutRecord.Time = FDateTime::UtcNow().GetTicks();
+	InOutRecord.Script = Dialogue ? Dialogue->GetClass()->GetFName() : NAME_None;
+	FDialogueTelemetry::Get().Record(InOutRecord);
 }
 
 //=================================================================
@@ -595,6 +880,9 @@ EDialogueEffect UDialogueManager::GetEffect() const
 //=================================================================
 bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, int32 InValue)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(AddContext);
+	SCOPE_CYCLE_COUNTER(STAT_DialogueContextWrite);
+
 	if (!InTag.IsValid())
 		return false;
 
@@ -606,6 +894,7 @@ bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, i
 #endif //
 
 	FContextMapType* pData = FindContextMap(InActorTag);
+	const SIZE_T OldStatSize = GetContextStatSize(pData);
 	if (!pData)
 	{
 		FSavedContextMap NewMap;
@@ -620,10 +909,12 @@ bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, i
 		if (*pValue == InValue)
 			return false;
 
+		RecordContextChange(EDialogueContextChange::Set, InTag, InActorTag, *pValue, InValue);
 		*pValue = InValue;
 
 		if (IsGlobalContext(InActorTag))
 		{
+			SIMPLEDIALOGUE_BROADCAST_SCOPE(OnGlobalContextChanged);
 			OnGlobalContextChanged.Broadcast(InTag, InValue);
 		}
 
@@ -650,6 +941,8 @@ bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, i
 	*/
 
 	pData->Emplace(InTag, InValue);
+	RecordContextChange(EDialogueContextChange::Set, InTag, InActorTag, 0, InValue);
+	UpdateContextStats(pData, OldStatSize);
 
 	/*
 	FSavedContext context;
@@ -661,6 +954,7 @@ bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, i
 
 	if (IsGlobalContext(InActorTag))
 	{
+		SIMPLEDIALOGUE_BROADCAST_SCOPE(OnGlobalContextChanged);
 		OnGlobalContextChanged.Broadcast(InTag, InValue);
 	}
 	return true;
@@ -671,6 +965,9 @@ bool UDialogueManager::AddContext(FGameplayTag InTag, FGameplayTag InActorTag, i
 //=================================================================
 bool UDialogueManager::RemoveContext(FGameplayTag InTag, FGameplayTag InActorTag)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(RemoveContext);
+	SCOPE_CYCLE_COUNTER(STAT_DialogueContextWrite);
+
 #if WITH_EDITOR
 	if (!IsValid(this))
 	{
@@ -682,13 +979,18 @@ bool UDialogueManager::RemoveContext(FGameplayTag InTag, FGameplayTag InActorTag
 	if (!pData)
 		return false;
 
-	if (!pData->Contains(InTag))
+	const int32 *pValue = pData->Find(InTag);
+	if (!pValue)
 		return false;
 
+	const SIZE_T OldStatSize = GetContextStatSize(pData);
+	RecordContextChange(EDialogueContextChange::Remove, InTag, InActorTag, *pValue, 0);
 	pData->Remove(InTag);
+	UpdateContextStats(pData, OldStatSize);
 
 	if (IsGlobalContext(InActorTag))
 	{
+		SIMPLEDIALOGUE_BROADCAST_SCOPE(OnGlobalContextChanged);
 		OnGlobalContextChanged.Broadcast(InTag, 0);
 	}
 
@@ -766,6 +1068,9 @@ bool UDialogueManager::IncreaseContextToLimit(FGameplayTag InTag, FGameplayTag I
 //=================================================================
 bool UDialogueManager::RemoveAllContextFor(FGameplayTag InActorTag)
 {
+	SIMPLEDIALOGUE_TRACE_SCOPE(RemoveAllContextFor);
+	SCOPE_CYCLE_COUNTER(STAT_DialogueContextWrite);
+
 	bool bSuccess = false;
 
 	/*
@@ -779,7 +1084,10 @@ bool UDialogueManager::RemoveAllContextFor(FGameplayTag InActorTag)
 	if (!pData || pData->Num() == 0)
 		return false;
 
+	const SIZE_T OldStatSize = GetContextStatSize(pData);
+	RecordContextChange(EDialogueContextChange::Clear, FGameplayTag(), InActorTag, 0, 0);
 	pData->Reset();
+	UpdateContextStats(pData, OldStatSize);
 
 	/*
 	//
@@ -0,0 +1,117 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueMemory.h"
+#include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueClassMemoryUsage::Get(const class UClass *InClass, FDialogueClassMemoryUsage &OutUsage)
+{
+	OutUsage = FDialogueClassMemoryUsage();
+	if (!InClass)
+		return;
+
+	OutUsage.Properties = InClass->GetStructureSize();
+
+	for (TFieldIterator<UFunction> It(InClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		OutUsage.Bytecode += It->Script.GetAllocatedSize();
+		OutUsage.NumFunctions++;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void DialogueMemReport(const TArray<FString> &Args, FOutputDevice &Ar)
+{
+	TMap<const UClass*, int32> Classes;
+	SIZE_T TotalInstances = 0;
+
+	Ar.Logf(TEXT("Dialogue instances (bytes):"));
+	Ar.Logf(TEXT("%-48s %-8s %8s %8s %8s %8s %8s %8s"), TEXT("Object"), TEXT("State"), TEXT("Object"), TEXT("Choices"), TEXT("Visited"), TEXT("Speakers"), TEXT("Text"), TEXT("Total"));
+
+	for (TObjectIterator<UDialogue> It; It; ++It)
+	{
+		class UDialogue *pDialogue = *It;
+		if (pDialogue->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			continue;
+
+		FDialogueMemoryUsage Usage;
+		pDialogue->GetMemoryUsage(Usage);
+		TotalInstances += Usage.GetTotal();
+
+		Classes.FindOrAdd(pDialogue->GetClass())++;
+
+		Ar.Logf(TEXT("%-48s %-8s %8llu %8llu %8llu %8llu %8llu %8llu"), *pDialogue->GetName(), pDialogue->IsActive() ? TEXT("Active") : TEXT("Inactive"),
+			(uint64)Usage.Object, (uint64)Usage.Choices, (uint64)Usage.VisitedChoices, (uint64)Usage.CustomSpeakers, (uint64)Usage.Text, (uint64)Usage.GetTotal());
+	}
+
+	Ar.Logf(TEXT("Instances total: %llu bytes"), (uint64)TotalInstances);
+
+	//Class data is shared, counted once per class
+	SIZE_T TotalClasses = 0;
+
+	Ar.Logf(TEXT(""));
+	Ar.Logf(TEXT("Dialogue classes (bytes):"));
+	Ar.Logf(TEXT("%-48s %9s %10s %9s %9s"), TEXT("Class"), TEXT("Instances"), TEXT("Properties"), TEXT("Functions"), TEXT("Bytecode"));
+
+	for (auto It = Classes.CreateConstIterator(); It; ++It)
+	{
+		FDialogueClassMemoryUsage Usage;
+		FDialogueClassMemoryUsage::Get(It.Key(), Usage);
+		TotalClasses += Usage.Bytecode;
+
+		Ar.Logf(TEXT("%-48s %9d %10llu %9d %9llu"), *It.Key()->GetName(), It.Value(), (uint64)Usage.Properties, Usage.NumFunctions, (uint64)Usage.Bytecode);
+	}
+
+	Ar.Logf(TEXT("Bytecode total: %llu bytes"), (uint64)TotalClasses);
+
+	//
+	TArray<FDialogueContextMemoryUsage> ContextUsage;
+
+	for (TObjectIterator<UDialogueManager> It; It; ++It)
+	{
+		class UDialogueManager *pManager = *It;
+		if (pManager->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			continue;
+
+		pManager->GetContextMemoryUsage(ContextUsage);
+
+		SIZE_T TotalContext = 0;
+		int32 iNumValues = 0;
+
+		Ar.Logf(TEXT(""));
+		Ar.Logf(TEXT("Context of %s (bytes):"), *pManager->GetPathName());
+		Ar.Logf(TEXT("%-48s %8s %8s"), TEXT("Actor"), TEXT("Values"), TEXT("Bytes"));
+
+		for (int32 i=0; i<ContextUsage.Num(); i++)
+		{
+			const FDialogueContextMemoryUsage &Usage = ContextUsage.GetData()[i];
+			TotalContext += Usage.Bytes;
+			iNumValues += Usage.Num;
+
+			Ar.Logf(TEXT("%-48s %8d %8llu"), Usage.ActorTag.IsValid() ? *Usage.ActorTag.ToString() : TEXT("(global)"), Usage.Num, (uint64)Usage.Bytes);
+		}
+
+		Ar.Logf(TEXT("Context total: %d values in %d maps, %llu bytes"), iNumValues, ContextUsage.Num(), (uint64)TotalContext);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand DialogueMemReportCommand(
+	TEXT("SimpleDialogue.MemReport"),
+	TEXT("Memory of every dialogue instance and class, and the context of every dialogue manager by actor tag. Can be added to MemReportCommands."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&DialogueMemReport));
+
+#endif //!UE_BUILD_SHIPPING
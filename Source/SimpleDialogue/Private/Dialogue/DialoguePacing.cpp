@@ -0,0 +1,367 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialoguePacing.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+//Fewer lines advanced by hand than this and the fit is noise
+static const uint32 MinFitLines = 8;
+
+bool FDialoguePacing::bRecording = false;
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialoguePacingHistogram::Add(float InShown, float InDelay, int32 InLetters, bool bInSkippedEarly)
+{
+	NumLines++;
+	TotalShown += InShown;
+	TotalDelay += InDelay;
+
+	if (InDelay > 0.0f)
+	{
+		const int32 iBucket = FMath::Clamp(FMath::FloorToInt(InShown / InDelay / RatioBucketSize), 0, NumRatioBuckets - 1);
+		RatioBuckets[iBucket]++;
+	}
+	else
+	{
+		NumUntimed++;
+	}
+
+	if (bInSkippedEarly && InDelay > 0.0f)
+	{
+		NumSkippedEarly++;
+	}
+
+	//Lines that ran out their delay only say the player was not faster
+	if (!bInSkippedEarly && InDelay > 0.0f)
+		return;
+
+	const int32 iBucket = FMath::Clamp(FMath::FloorToInt(InShown / ShownBucketSize), 0, NumShownBuckets - 1);
+	ShownBuckets[iBucket]++;
+
+	NumFit++;
+	SumLetters += InLetters;
+	SumShown += InShown;
+	SumLettersSquared += (double)InLetters * InLetters;
+	SumLettersShown += (double)InLetters * InShown;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialoguePacingHistogram::Merge(const FDialoguePacingHistogram &InOther)
+{
+	for (int32 i=0; i<NumRatioBuckets; i++)
+	{
+		RatioBuckets[i] += InOther.RatioBuckets[i];
+	}
+
+	for (int32 i=0; i<NumShownBuckets; i++)
+	{
+		ShownBuckets[i] += InOther.ShownBuckets[i];
+	}
+
+	NumLines += InOther.NumLines;
+	NumSkippedEarly += InOther.NumSkippedEarly;
+	NumUntimed += InOther.NumUntimed;
+	TotalShown += InOther.TotalShown;
+	TotalDelay += InOther.TotalDelay;
+
+	NumFit += InOther.NumFit;
+	SumLetters += InOther.SumLetters;
+	SumShown += InOther.SumShown;
+	SumLettersSquared += InOther.SumLettersSquared;
+	SumLettersShown += InOther.SumLettersShown;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialoguePacingHistogram::FitTiming(float &OutTimePerLetter, float &OutAdditionalTextTime) const
+{
+	if (NumFit < MinFitLines)
+		return false;
+
+	const double flDenominator = NumFit * SumLettersSquared - SumLetters * SumLetters;
+	if (FMath::Abs(flDenominator) < KINDA_SMALL_NUMBER)
+		return false;
+
+	OutTimePerLetter = (float)((NumFit * SumLettersShown - SumLetters * SumShown) / flDenominator);
+	OutAdditionalTextTime = (float)((SumShown - OutTimePerLetter * SumLetters) / NumFit);
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+float FDialoguePacingHistogram::GetShownPercentile(float InFraction) const
+{
+	if (NumFit == 0)
+		return 0.0f;
+
+	const uint32 iTarget = FMath::Max<uint32>(1, FMath::CeilToInt(NumFit * InFraction));
+
+	uint32 iCount = 0;
+	for (int32 i=0; i<NumShownBuckets; i++)
+	{
+		iCount += ShownBuckets[i];
+		if (iCount >= iTarget)
+			return (i + 1) * ShownBucketSize;
+	}
+
+	return NumShownBuckets * ShownBucketSize;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FArchive &operator<<(FArchive &Ar, FDialoguePacingHistogram &Histogram)
+{
+	for (int32 i=0; i<FDialoguePacingHistogram::NumRatioBuckets; i++)
+	{
+		Ar << Histogram.RatioBuckets[i];
+	}
+
+	for (int32 i=0; i<FDialoguePacingHistogram::NumShownBuckets; i++)
+	{
+		Ar << Histogram.ShownBuckets[i];
+	}
+
+	Ar << Histogram.NumLines << Histogram.NumSkippedEarly << Histogram.NumUntimed << Histogram.TotalShown << Histogram.TotalDelay;
+	Ar << Histogram.NumFit << Histogram.SumLetters << Histogram.SumShown << Histogram.SumLettersSquared << Histogram.SumLettersShown;
+	return Ar;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialoguePacing &FDialoguePacing::Get()
+{
+	static FDialoguePacing Pacing;
+	return Pacing;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialoguePacing::AddLine(FName InScript, FName InKey, float InShown, float InDelay, int32 InLetters, bool bInSkippedEarly)
+{
+	Scripts.FindOrAdd(InScript).Add(InShown, InDelay, InLetters, bInSkippedEarly);
+
+	if (!InKey.IsNone())
+	{
+		Keys.FindOrAdd(TPair<FName, FName>(InScript, InKey)).Add(InShown, InDelay, InLetters, bInSkippedEarly);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialoguePacing::Reset()
+{
+	Scripts.Reset();
+	Keys.Reset();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialoguePacing::Merge(const FDialoguePacing &InOther)
+{
+	for (auto It = InOther.Scripts.CreateConstIterator(); It; ++It)
+	{
+		Scripts.FindOrAdd(It.Key()).Merge(It.Value());
+	}
+
+	for (auto It = InOther.Keys.CreateConstIterator(); It; ++It)
+	{
+		Keys.FindOrAdd(It.Key()).Merge(It.Value());
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FString FDialoguePacing::GetDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SimpleDialogue") / TEXT("Pacing");
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialoguePacing::Save(const FString &InFilename) const
+{
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*InFilename));
+	if (!File)
+		return false;
+
+	FNameAsStringProxyArchive Ar(*File);
+
+	uint32 iMagic = FileMagic;
+	uint32 iVersion = FileVersion;
+	Ar << iMagic << iVersion;
+
+	int32 iNum = Scripts.Num();
+	Ar << iNum;
+	for (auto It = Scripts.CreateConstIterator(); It; ++It)
+	{
+		FName Script = It.Key();
+		FDialoguePacingHistogram Histogram = It.Value();
+		Ar << Script << Histogram;
+	}
+
+	iNum = Keys.Num();
+	Ar << iNum;
+	for (auto It = Keys.CreateConstIterator(); It; ++It)
+	{
+		FName Script = It.Key().Key;
+		FName Key = It.Key().Value;
+		FDialoguePacingHistogram Histogram = It.Value();
+		Ar << Script << Key << Histogram;
+	}
+
+	return File->Close();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialoguePacing::Flush(const FString &InFilename)
+{
+	if (!Save(InFilename))
+		return false;
+
+	Reset();
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FString FDialoguePacing::MakeFilename()
+{
+	//Saving twice within a second must not overwrite the first file
+	return FPaths::CreateTempFilename(*GetDirectory(), *(FDateTime::Now().ToString() + TEXT("-")), TEXT(".pacing"));
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialoguePacing::Load(const FString &InFilename)
+{
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileReader(*InFilename));
+	if (!File)
+		return false;
+
+	FNameAsStringProxyArchive Ar(*File);
+
+	uint32 iMagic = 0;
+	uint32 iVersion = 0;
+	Ar << iMagic << iVersion;
+	if (iMagic != FileMagic || iVersion != FileVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Skipping %s, not a dialogue pacing file of version %u"), *InFilename, FileVersion);
+		return false;
+	}
+
+	int32 iNum = 0;
+	Ar << iNum;
+	for (int32 i=0; i<iNum && !Ar.IsError(); i++)
+	{
+		FName Script;
+		FDialoguePacingHistogram Histogram;
+		Ar << Script << Histogram;
+		Scripts.FindOrAdd(Script).Merge(Histogram);
+	}
+
+	Ar << iNum;
+	for (int32 i=0; i<iNum && !Ar.IsError(); i++)
+	{
+		FName Script;
+		FName Key;
+		FDialoguePacingHistogram Histogram;
+		Ar << Script << Key << Histogram;
+		Keys.FindOrAdd(TPair<FName, FName>(Script, Key)).Merge(Histogram);
+	}
+
+	return !Ar.IsError();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+int32 FDialoguePacing::LoadDirectory()
+{
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(GetDirectory() / TEXT("*.pacing")), true, false);
+
+	int32 iLoaded = 0;
+	for (int32 i=0; i<Files.Num(); i++)
+	{
+		if (Load(GetDirectory() / Files.GetData()[i]))
+		{
+			iLoaded++;
+		}
+	}
+
+	return iLoaded;
+}
+
+#if SIMPLEDIALOGUE_PACING
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FAutoConsoleVariableRef FDialoguePacing::RecordVariable(
+	TEXT("SimpleDialogue.Pacing.Record"),
+	FDialoguePacing::bRecording,
+	TEXT("Records how long lines shown in game worlds stay on screen, for the Dialogue Pacing report."));
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void SavePacing(const TArray<FString> &Args)
+{
+	const FString Filename = Args.Num() > 0 ? Args[0] : FDialoguePacing::MakeFilename();
+	if (FDialoguePacing::Get().Flush(Filename))
+	{
+		UE_LOG(LogTemp, Display, TEXT("Dialogue pacing saved to %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save dialogue pacing to %s"), *Filename);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void ResetPacing(const TArray<FString> &Args)
+{
+	FDialoguePacing::Get().Reset();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand SavePacingCommand(
+	TEXT("SimpleDialogue.Pacing.Save"),
+	TEXT("Saves line timing histograms recorded so far. Optional argument: file name, default is a new file in Saved/SimpleDialogue/Pacing."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&SavePacing));
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand ResetPacingCommand(
+	TEXT("SimpleDialogue.Pacing.Reset"),
+	TEXT("Clears line timing histograms recorded so far."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&ResetPacing));
+
+#endif //SIMPLEDIALOGUE_PACING
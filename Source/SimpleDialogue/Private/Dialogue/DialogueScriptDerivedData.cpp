@@ -0,0 +1,211 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueScriptDerivedData.h"
+
+#if WITH_EDITOR
+
+#include "Dialogue/DialogueTextPinIndex.h"
+#include "Dialogue/DialogueScriptTree.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraphNode.h"
+#include "DerivedDataCacheInterface.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/PackageName.h"
+
+//Change when the serialized data or the way lines are gathered changes
+#define DIALOGUE_SCRIPT_DERIVED_DATA_VERSION TEXT("5C1E2A9D6F4B4E0C8A7D3B2F1E0D9C8B")
+
+//=================================================================
+//
+//=================================================================
+FArchive &operator<<(FArchive &Ar, FDialogueScriptLine &Line)
+{
+	Ar << Line.Text;
+	Ar << Line.Speaker;
+	Ar << Line.Expression;
+	Ar << Line.TableId;
+	Ar << Line.Key;
+	Ar << Line.NodeGuid;
+	Ar << Line.PinId;
+	return Ar;
+}
+
+//=================================================================
+//
+//=================================================================
+FString FDialogueScriptDerivedData::GetSavedPackageKey(FName InPackageName)
+{
+	//Updated by the asset registry when the package is saved, nothing is read from the file
+	IAssetRegistry *pAssetRegistry = IAssetRegistry::Get();
+	if (pAssetRegistry)
+	{
+		TOptional<FAssetPackageData> PackageData = pAssetRegistry->GetAssetPackageDataCopy(InPackageName);
+		if (PackageData.IsSet() && !PackageData->PackageSavedHash.IsZero())
+			return LexToString(PackageData->PackageSavedHash);
+	}
+
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(InPackageName.ToString(), &Filename))
+		return FString();
+
+	FFileStatData Stat = IFileManager::Get().GetStatData(*Filename);
+	if (!Stat.bIsValid)
+		return FString();
+
+	return FString::Printf(TEXT("%lld_%lld"), Stat.ModificationTime.GetTicks(), Stat.FileSize);
+}
+
+//=================================================================
+//
+//=================================================================
+FString FDialogueScriptDerivedData::GetCacheKey(class UBlueprint *InBlueprint)
+{
+	class UPackage *pPackage = InBlueprint->GetOutermost();
+	if (!pPackage || pPackage->IsDirty())
+		return FString();
+
+	FString PackageKey = GetSavedPackageKey(pPackage->GetFName());
+	if (PackageKey.Len() == 0)
+		return FString();
+
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("SIMPLEDIALOGUE_SCRIPT"), DIALOGUE_SCRIPT_DERIVED_DATA_VERSION, *PackageKey);
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueScriptDerivedData::GatherLines(class UBlueprint *InBlueprint, TArray<FDialogueScriptLine> &OutLines)
+{
+	OutLines.Reset();
+
+	if (!IsValid(InBlueprint))
+		return;
+
+	FDialogueTextPinIndex &Index = FDialogueTextPinIndex::Get();
+	const TArray<FEdGraphPinReference> &Pins = Index.GetPins(InBlueprint);
+	TSharedRef<const FDialogueScriptTree> Tree = Index.GetScriptTree(InBlueprint);
+
+	//Speaker and expression are already resolved in the tree
+	TMap<const class UEdGraphPin*, const FDialogueScriptItem*> PinToItem;
+	Tree->Visit([&PinToItem](const FDialogueScriptItem &Item, int32 Depth)
+	{
+		const class UEdGraphPin *pPin = Item.TextPin.Get();
+		if (pPin)
+		{
+			PinToItem.FindOrAdd(pPin, &Item);
+		}
+	});
+
+	OutLines.Reserve(Pins.Num());
+
+	for (int32 i=0; i<Pins.Num(); i++)
+	{
+		class UEdGraphPin *pPin = Pins.GetData()[i].Get();
+		if (!pPin)
+			continue;
+
+		FDialogueScriptLine &Line = OutLines.AddDefaulted_GetRef();
+		Line.Text = pPin->DefaultTextValue;
+		Line.PinId = pPin->PinId;
+
+		if (pPin->GetOwningNode())
+		{
+			Line.NodeGuid = pPin->GetOwningNode()->NodeGuid;
+		}
+
+		if (Line.Text.IsFromStringTable())
+		{
+			FName TableId;
+			FTextInspector::GetTableIdAndKey(Line.Text, TableId, Line.Key);
+			Line.TableId = TableId.ToString();
+		}
+
+		const FDialogueScriptItem *const *ppItem = PinToItem.Find(pPin);
+		if (ppItem && (*ppItem)->Type == EDialogueScriptItemType::Line)
+		{
+			Line.Speaker = (*ppItem)->Speaker;
+			Line.Expression = (*ppItem)->Expression;
+		}
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+bool FDialogueScriptDerivedData::GetLines(class UBlueprint *InBlueprint, TArray<FDialogueScriptLine> &OutLines)
+{
+	OutLines.Reset();
+
+	if (!IsValid(InBlueprint))
+		return false;
+
+	FString CacheKey = GetCacheKey(InBlueprint);
+	if (CacheKey.Len() == 0)
+	{
+		GatherLines(InBlueprint, OutLines);
+		return OutLines.Num() > 0;
+	}
+
+	FString DataContext = InBlueprint->GetPathName();
+
+	TArray<uint8> Data;
+	if (GetDerivedDataCacheRef().GetSynchronous(*CacheKey, Data, DataContext))
+	{
+		FMemoryReader Reader(Data, true);
+		Reader << OutLines;
+
+		if (!Reader.IsError())
+			return OutLines.Num() > 0;
+
+		OutLines.Reset();
+	}
+
+	GatherLines(InBlueprint, OutLines);
+
+	Data.Reset();
+	FMemoryWriter Writer(Data, true);
+	Writer << OutLines;
+	GetDerivedDataCacheRef().Put(*CacheKey, Data, DataContext);
+
+	return OutLines.Num() > 0;
+}
+
+//=================================================================
+//
+//=================================================================
+class UEdGraphPin *FDialogueScriptDerivedData::FindPin(class UBlueprint *InBlueprint, const FGuid &InNodeGuid, const FGuid &InPinId)
+{
+	if (!IsValid(InBlueprint) || !InNodeGuid.IsValid())
+		return NULL;
+
+	TArray<class UEdGraph*> Graphs;
+	InBlueprint->GetAllGraphs(Graphs);
+
+	for (int32 i=0; i<Graphs.Num(); i++)
+	{
+		class UEdGraph *pGraph = Graphs.GetData()[i];
+		if (!pGraph)
+			continue;
+
+		for (int32 j=0; j<pGraph->Nodes.Num(); j++)
+		{
+			class UEdGraphNode *pNode = pGraph->Nodes.GetData()[j];
+			if (!pNode || pNode->NodeGuid != InNodeGuid)
+				continue;
+
+			return pNode->FindPinById(InPinId);
+		}
+	}
+
+	return NULL;
+}
+
+#undef DIALOGUE_SCRIPT_DERIVED_DATA_VERSION
+
+#endif //WITH_EDITOR
@@ -0,0 +1,108 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueScriptExporter.h"
+
+#if WITH_EDITOR
+
+#include "Dialogue/DialogueScriptTree.h"
+#include "Dialogue/DialogueTextPinIndex.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+
+//=================================================================
+//
+//=================================================================
+void FDialogueScriptArchiveWriter::WriteLine(int32 InDepth, FStringView InLine)
+{
+	TStringBuilder<512> Builder;
+	for (int32 i=0; i<InDepth; i++)
+	{
+		Builder.AppendChar(TEXT('\t'));
+	}
+	Builder.Append(InLine);
+	Builder.Append(TEXT("\r\n"));
+
+	FTCHARToUTF8 Converted(Builder.GetData(), Builder.Len());
+	Archive.Serialize((void*)Converted.Get(), Converted.Length());
+}
+
+//=================================================================
+//
+//=================================================================
+int32 FDialogueScriptExporter::Export(class UBlueprint *InBlueprint, FDialogueScriptWriter &Writer)
+{
+	if (!IsValid(InBlueprint))
+		return 0;
+
+	TSharedRef<const FDialogueScriptTree> Tree = FDialogueTextPinIndex::Get().GetScriptTree(InBlueprint);
+
+	TStringBuilder<512> Builder;
+	int32 iLines = 0;
+	Tree->Visit([&Writer, &Tree, &Builder, &iLines](const FDialogueScriptItem &Item, int32 Depth)
+	{
+		//Event contents are written at the same level as the event header
+		int32 iDepth = FMath::Max(0, Depth - 1);
+
+		Builder.Reset();
+		if (Item.Type == EDialogueScriptItemType::Jump)
+		{
+			const FDialogueScriptItem *pTarget = Tree->GetJumpTarget(Item);
+			Builder.AppendChar(StructurePrefix);
+			Builder.Append(TEXT("-> "));
+			Builder.Append(pTarget ? FDialogueScriptTree::GetItemString(*pTarget) : FString(TEXT("End")));
+		}
+		else
+		{
+			FString Line = FDialogueScriptTree::GetItemString(Item);
+			if (Item.Type != EDialogueScriptItemType::Line)
+			{
+				Builder.AppendChar(StructurePrefix);
+			}
+			else if (Line.Len() > 0 && (Line[0] == StructurePrefix || Line[0] == Escape))
+			{
+				Builder.AppendChar(Escape);
+			}
+			Builder.Append(Line);
+		}
+
+		Writer.WriteLine(iDepth, Builder.ToView());
+
+		iLines++;
+	});
+
+	return iLines;
+}
+
+//=================================================================
+//
+//=================================================================
+FStringView FDialogueScriptExporter::UnescapeLine(FStringView InLine)
+{
+	//Only an escape in front of the prefix or another escape was written by Export, anything else is text
+	if (InLine.Len() >= 2 && InLine[0] == Escape && (InLine[1] == StructurePrefix || InLine[1] == Escape))
+		return InLine.RightChop(1);
+
+	return InLine;
+}
+
+//=================================================================
+//
+//=================================================================
+bool FDialogueScriptExporter::ExportToFile(class UBlueprint *InBlueprint, const FString &InFilename)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*InFilename));
+	if (!Archive)
+		return false;
+
+	FDialogueScriptArchiveWriter Writer(*Archive);
+	int32 iLines = Export(InBlueprint, Writer);
+
+	bool bSuccess = Archive->Close();
+
+	UE_LOG(LogTemp, Display, TEXT("Exported %d script lines to \"%s\""), iLines, *InFilename);
+	return bSuccess;
+}
+
+#endif //WITH_EDITOR
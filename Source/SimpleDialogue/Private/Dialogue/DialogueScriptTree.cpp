@@ -0,0 +1,301 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueScriptTree.h"
+
+#if WITH_EDITOR
+
+#include "Dialogue/Dialogue.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ExecutionSequence.h"
+
+//=================================================================
+//
+//=================================================================
+static FName GetCalledFunctionName(const class UEdGraphNode *InNode)
+{
+	const UK2Node_CallFunction *pCall = Cast<UK2Node_CallFunction>(InNode);
+	if (!pCall)
+		return NAME_None;
+
+	return pCall->FunctionReference.GetMemberName();
+}
+
+//=================================================================
+//
+//=================================================================
+bool FDialogueScriptTree::IsDialogueBoxNode(const class UEdGraphNode *InNode)
+{
+	FName FunctionName = GetCalledFunctionName(InNode);
+	return FunctionName == GET_FUNCTION_NAME_CHECKED(UDialogue, DialogueBox) || FunctionName == GET_FUNCTION_NAME_CHECKED(UDialogue, DialogueBoxNoLatent);
+}
+
+//=================================================================
+//
+//=================================================================
+bool FDialogueScriptTree::IsDialogueChoiceNode(const class UEdGraphNode *InNode)
+{
+	return GetCalledFunctionName(InNode) == GET_FUNCTION_NAME_CHECKED(UDialogue, DialogueChoices);
+}
+
+//=================================================================
+//
+//=================================================================
+static bool IsExecPin(const class UEdGraphPin *InPin, EEdGraphPinDirection InDirection)
+{
+	return InPin && InPin->Direction == InDirection && InPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+}
+
+//=================================================================
+//
+//=================================================================
+static bool IsEntryNode(const class UEdGraphNode *InNode)
+{
+	bool bHasLinkedOutput = false;
+	for (int32 i=0; i<InNode->Pins.Num(); i++)
+	{
+		const class UEdGraphPin *pPin = InNode->Pins.GetData()[i];
+		if (IsExecPin(pPin, EGPD_Input))
+			return false;
+
+		if (IsExecPin(pPin, EGPD_Output) && pPin->LinkedTo.Num() > 0)
+		{
+			bHasLinkedOutput = true;
+		}
+	}
+
+	return bHasLinkedOutput;
+}
+
+//=================================================================
+//
+//=================================================================
+static void FillItemFromNode(const class UEdGraphNode *InNode, FDialogueScriptItem &Item)
+{
+	class UEdGraphPin *pTextPin = InNode->FindPin(TEXT("Text"), EGPD_Input);
+	if (pTextPin)
+	{
+		Item.Text = pTextPin->DefaultTextValue;
+		Item.TextPin = FEdGraphPinReference(pTextPin);
+	}
+
+	if (Item.Type != EDialogueScriptItemType::Line)
+		return;
+
+	const class UEdGraphPin *pSpeakerPin = InNode->FindPin(TEXT("Speaker"), EGPD_Input);
+	if (pSpeakerPin)
+	{
+		Item.Speaker = pSpeakerPin->DefaultValue;
+	}
+
+	const class UEdGraphPin *pExpressionPin = InNode->FindPin(TEXT("Expression"), EGPD_Input);
+	if (pExpressionPin && !pExpressionPin->DefaultValue.Equals(TEXT("None"), ESearchCase::IgnoreCase))
+	{
+		Item.Expression = pExpressionPin->DefaultValue;
+	}
+
+	//(TagName="Character.Name.Abigail")
+	const class UEdGraphPin *pCustomPin = InNode->FindPin(TEXT("InCustomName"), EGPD_Input);
+	if (pCustomPin && Item.Speaker == TEXT("Custom"))
+	{
+		FString CustomSpeaker = pCustomPin->DefaultValue;
+		CustomSpeaker.ReplaceInline(TEXT("\""), TEXT(""), ESearchCase::CaseSensitive);
+		CustomSpeaker.ReplaceInline(TEXT(")"), TEXT(""), ESearchCase::CaseSensitive);
+
+		FString SimpleName;
+		if (CustomSpeaker.Split(TEXT("."), NULL, &SimpleName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		{
+			Item.Speaker = SimpleName;
+		}
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueScriptTree::Build(class UBlueprint *InBlueprint, FDialogueScriptTree &OutTree)
+{
+	OutTree.Items.Reset();
+	OutTree.Roots.Reset();
+	OutTree.NumLines = 0;
+
+	if (!IsValid(InBlueprint))
+		return;
+
+	//Node to walk and the item its output goes into
+	struct FStackItem
+	{
+		const class UEdGraphNode *Node;
+		int32 Parent;
+	};
+
+	TArray<FStackItem> Stack;
+	TArray<const class UEdGraphPin*> Outputs;
+
+	//Where each graph node was first written, shared paths and loops jump there
+	TMap<const class UEdGraphNode*, TPair<int32, int32>> Written;
+
+	TArray<class UEdGraph*> Graphs;
+	InBlueprint->GetAllGraphs(Graphs);
+
+	for (int32 i=0; i<Graphs.Num(); i++)
+	{
+		class UEdGraph *pGraph = Graphs.GetData()[i];
+		if (!pGraph)
+			continue;
+
+		for (int32 j=0; j<pGraph->Nodes.Num(); j++)
+		{
+			const class UEdGraphNode *pEntry = pGraph->Nodes.GetData()[j];
+			if (!pEntry || !IsEntryNode(pEntry))
+				continue;
+
+			int32 iRoot = OutTree.Items.AddDefaulted();
+			OutTree.Items.GetData()[iRoot].Type = EDialogueScriptItemType::Entry;
+			OutTree.Items.GetData()[iRoot].Label = pEntry->GetNodeTitle(ENodeTitleType::ListView).ToString();
+			OutTree.Roots.Add(iRoot);
+
+			//Explicit stack, long conversations are far deeper than the call stack would allow
+			Stack.Reset();
+			Stack.Add({ pEntry, iRoot });
+
+			while (Stack.Num() > 0)
+			{
+				FStackItem Current = Stack.Pop();
+
+				const TPair<int32, int32> *pWritten = Written.Find(Current.Node);
+				if (pWritten)
+				{
+					FDialogueScriptItem Jump;
+					Jump.Type = EDialogueScriptItemType::Jump;
+					Jump.JumpParent = pWritten->Key;
+					Jump.JumpChild = pWritten->Value;
+
+					int32 iJump = OutTree.Items.Add(MoveTemp(Jump));
+					OutTree.Items.GetData()[Current.Parent].Children.Add(iJump);
+					continue;
+				}
+
+				Written.Add(Current.Node, TPair<int32, int32>(Current.Parent, OutTree.Items.GetData()[Current.Parent].Children.Num()));
+
+				int32 iChildParent = Current.Parent;
+
+				bool bLine = IsDialogueBoxNode(Current.Node);
+				bool bChoice = !bLine && IsDialogueChoiceNode(Current.Node);
+				if (bLine || bChoice)
+				{
+					FDialogueScriptItem Item;
+					Item.Type = bLine ? EDialogueScriptItemType::Line : EDialogueScriptItemType::Choice;
+					FillItemFromNode(Current.Node, Item);
+
+					int32 iItem = OutTree.Items.Add(MoveTemp(Item));
+					OutTree.Items.GetData()[Current.Parent].Children.Add(iItem);
+
+					if (bLine)
+					{
+						OutTree.NumLines++;
+					}
+					else
+					{
+						iChildParent = iItem;
+					}
+				}
+
+				Outputs.Reset();
+				for (int32 k=0; k<Current.Node->Pins.Num(); k++)
+				{
+					const class UEdGraphPin *pPin = Current.Node->Pins.GetData()[k];
+					if (IsExecPin(pPin, EGPD_Output) && pPin->LinkedTo.Num() > 0)
+					{
+						Outputs.Add(pPin);
+					}
+				}
+
+				//Sequences run one after another in the same parent, other branching nodes get an item per output
+				bool bBranching = !bChoice && Outputs.Num() > 1 && !Current.Node->IsA<UK2Node_ExecutionSequence>();
+
+				TArray<int32, TInlineAllocator<8>> OutputParents;
+				for (int32 k=0; k<Outputs.Num(); k++)
+				{
+					if (!bBranching)
+					{
+						OutputParents.Add(iChildParent);
+						continue;
+					}
+
+					FDialogueScriptItem Branch;
+					Branch.Type = EDialogueScriptItemType::Branch;
+					Branch.Label = Outputs.GetData()[k]->GetDisplayName().ToString();
+
+					int32 iBranch = OutTree.Items.Add(MoveTemp(Branch));
+					OutTree.Items.GetData()[iChildParent].Children.Add(iBranch);
+					OutputParents.Add(iBranch);
+				}
+
+				//Pushed in reverse so that the first output is walked first
+				for (int32 k=Outputs.Num() - 1; k>=0; k--)
+				{
+					const class UEdGraphPin *pOutput = Outputs.GetData()[k];
+					for (int32 l=pOutput->LinkedTo.Num() - 1; l>=0; l--)
+					{
+						const class UEdGraphPin *pLinked = pOutput->LinkedTo.GetData()[l];
+						if (pLinked && pLinked->GetOwningNode())
+						{
+							Stack.Add({ pLinked->GetOwningNode(), OutputParents.GetData()[k] });
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+FString FDialogueScriptTree::GetItemString(const FDialogueScriptItem &InItem)
+{
+	switch (InItem.Type)
+	{
+	case EDialogueScriptItemType::Entry:
+		return TEXT("# ") + InItem.Label;
+	case EDialogueScriptItemType::Branch:
+		return TEXT("[") + InItem.Label + TEXT("]");
+	case EDialogueScriptItemType::Choice:
+		return TEXT("* ") + InItem.Text.ToString();
+	case EDialogueScriptItemType::Jump:
+		return TEXT("->");
+	default:
+		break;
+	}
+
+	FString Line = FString::Printf(TEXT("%s: %s"), *InItem.Speaker, *InItem.Text.ToString());
+	if (InItem.Expression.Len() > 0)
+	{
+		Line += TEXT(" (") + InItem.Expression + TEXT(")");
+	}
+
+	return Line;
+}
+
+//=================================================================
+//
+//=================================================================
+const FDialogueScriptItem *FDialogueScriptTree::GetJumpTarget(const FDialogueScriptItem &InItem) const
+{
+	if (InItem.Type != EDialogueScriptItemType::Jump || !Items.IsValidIndex(InItem.JumpParent))
+		return NULL;
+
+	const TArray<int32> &Children = Items.GetData()[InItem.JumpParent].Children;
+	if (!Children.IsValidIndex(InItem.JumpChild))
+		return NULL;
+
+	return &Items.GetData()[Children.GetData()[InItem.JumpChild]];
+}
+
+#endif //WITH_EDITOR
@@ -0,0 +1,29 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueSettings.h"
+#include "Dialogue/DialogueContextTagCatalogue.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+UDialogueSettings::UDialogueSettings()
+{
+	CategoryName = TEXT("Plugins");
+
+	ContextRoots.Add(TEXT("Context"));
+	ContextRoots.Add(TEXT("Docks"));
+}
+
+#if WITH_EDITOR
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueSettings::PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	FDialogueContextTagCatalogue::Get().Invalidate();
+}
+#endif //WITH_EDITOR
@@ -0,0 +1,350 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueSimulator.h"
+#include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueManager.h"
+#include "Dialogue/DialoguePacing.h"
+#include "Engine/World.h"
+#include "Engine/LatentActionManager.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_EDITOR
+#include "Dialogue/DialogueScriptDerivedData.h"
+#include "Engine/Blueprint.h"
+#endif //
+
+//Latent actions are ticked this long at a time while the dialogue shows nothing
+static const float IdleStep = 0.25f;
+
+//Seconds of idle ticking before the run is a dead end
+static const float MaxIdleTime = 60.0f;
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FString FDialogueSimulationReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%s: %d runs, %d completed, %d dead ends, %d truncated%s. %d lines and %d choices reached, average path %.1f lines, longest %d"),
+		*Script, NumRuns, NumCompleted, NumDeadEnds, NumTruncated, bExhausted ? TEXT(", every path played") : TEXT(""),
+		ReachedLines.Num(), ReachedChoices.Num(), AveragePathLength, LongestPath);
+
+	if (ScriptLines.Num() > 0)
+	{
+		Result += FString::Printf(TEXT(", %d of %d script lines reached"), ScriptLines.Intersect(ReachedLines).Num(), ScriptLines.Num());
+	}
+
+	for (int32 i=0; i<DeadEnds.Num(); i++)
+	{
+		Result += FString::Printf(TEXT("\n\tDead end: %s"), *DeadEnds.GetData()[i]);
+	}
+
+	TArray<FString> Lines = ReachedLines.Array();
+	Lines.Sort();
+	for (int32 i=0; i<Lines.Num(); i++)
+	{
+		Result += FString::Printf(TEXT("\n\tReached: %s"), *Lines.GetData()[i]);
+	}
+
+	Lines = ScriptLines.Difference(ReachedLines).Array();
+	Lines.Sort();
+	for (int32 i=0; i<Lines.Num(); i++)
+	{
+		Result += FString::Printf(TEXT("\n\tUnreached: %s"), *Lines.GetData()[i]);
+	}
+
+	return Result;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueSimulator::FDialogueSimulator(TSubclassOf<class UDialogue> InClass, const FDialogueSimulationSettings &InSettings)
+	: DialogueClass(InClass)
+	, Settings(InSettings)
+	, Random(InSettings.RandomSeed)
+{
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueSimulator::~FDialogueSimulator()
+{
+	DestroyWorld();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueSimulator::CreateWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::GamePreview, false, TEXT("DialogueSimulation"));
+	if (!World)
+		return false;
+
+	World->AddToRoot();
+
+	Player = World->SpawnActor<AActor>();
+	Target = World->SpawnActor<AActor>();
+	if (!Player || !Target)
+		return false;
+
+	Manager = NewObject<UDialogueManager>(Player);
+	Manager->RegisterComponent();
+	Manager->Initialize(NULL);
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueSimulator::DestroyWorld()
+{
+	if (Manager)
+	{
+		Manager->ClearDialogue();
+		Manager = NULL;
+	}
+
+	Player = NULL;
+	Target = NULL;
+
+	if (World)
+	{
+		World->RemoveFromRoot();
+		World->DestroyWorld(false);
+		World = NULL;
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueSimulator::ERunResult FDialogueSimulator::PlayOnce(const TArray<int32> &InPath, TArray<int32> &OutPath, TArray<int32> &OutNumOptions, FString &OutChoiceLog, int32 &OutNumLines, FDialogueSimulationReport &OutReport)
+{
+	OutPath.Reset();
+	OutNumOptions.Reset();
+	OutChoiceLog.Reset();
+	OutNumLines = 0;
+
+	Manager->ClearDialogue();
+	Manager->RestoreContextSnapshot(Settings.Context);
+	FMath::RandInit(Settings.RandomSeed);
+
+	if (!Manager->SpeakDialogue(TSoftClassPtr<UDialogue>(DialogueClass.Get()), Player, Target, Settings.SpeakContext, false))
+	{
+		//Some scripts finish during activation
+		return ERunResult::Completed;
+	}
+
+	TArray<int32> Selectable;
+	float flIdleTime = 0.0f;
+
+	for (int32 iStep=0; iStep<Settings.MaxSteps; iStep++)
+	{
+		class UDialogue *pDialogue = const_cast<UDialogue*>(Manager->GetDialogue());
+		if (!pDialogue)
+			return ERunResult::Completed;
+
+		if (pDialogue->HasChoices())
+		{
+			flIdleTime = 0.0f;
+
+			const TArray<FDialogueChoice> &Choices = pDialogue->GetChoices();
+
+			Selectable.Reset();
+			for (int32 i=0; i<Choices.Num(); i++)
+			{
+				if (pDialogue->CanSelectOption(i))
+				{
+					Selectable.Add(i);
+				}
+			}
+
+			if (Selectable.Num() == 0)
+				return ERunResult::DeadEnd;
+
+			int32 iPick = 0;
+			if (OutPath.Num() < InPath.Num())
+			{
+				iPick = FMath::Clamp(InPath.GetData()[OutPath.Num()], 0, Selectable.Num() - 1);
+			}
+			else if (Settings.Mode == EDialogueSimulationMode::RandomWalk)
+			{
+				iPick = Random.RandRange(0, Selectable.Num() - 1);
+			}
+
+			OutPath.Add(iPick);
+			OutNumOptions.Add(Selectable.Num());
+
+			const FString Title = Choices.GetData()[Selectable.GetData()[iPick]].Title.ToString();
+			OutReport.ReachedChoices.Add(Title);
+			OutChoiceLog += FString::Printf(TEXT("%s%d:%s"), OutChoiceLog.Len() > 0 ? TEXT(" > ") : TEXT(""), Selectable.GetData()[iPick], *Title);
+
+			pDialogue->SelectOption(Selectable.GetData()[iPick]);
+			continue;
+		}
+
+		if (pDialogue->HasDialogue())
+		{
+			flIdleTime = 0.0f;
+
+			OutReport.ReachedLines.Add(pDialogue->GetText().ToString());
+			OutNumLines++;
+
+			pDialogue->Skip();
+			continue;
+		}
+
+		//Waiting on a delay or some other latent action
+		if (flIdleTime >= MaxIdleTime)
+			return ERunResult::DeadEnd;
+
+		FLatentActionManager &LatentActions = World->GetLatentActionManager();
+		LatentActions.BeginFrame();
+		LatentActions.ProcessLatentActions(NULL, IdleStep);
+		pDialogue->Update(IdleStep);
+		flIdleTime += IdleStep;
+
+		//Idle ticks are not steps
+		iStep--;
+	}
+
+	return ERunResult::Truncated;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueSimulator::Run(FDialogueSimulationReport &OutReport)
+{
+	OutReport = FDialogueSimulationReport();
+	OutReport.Script = DialogueClass ? DialogueClass->GetPathName() : TEXT("NULL");
+
+	if (!DialogueClass)
+		return false;
+
+	if (!World && !CreateWorld())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create simulation world for \"%s\""), *OutReport.Script);
+		DestroyWorld();
+		return false;
+	}
+
+	//Skip is called right after every line is shown
+	FDialoguePacing::FScopedDisable NoPacing;
+
+#if WITH_EDITOR
+	//Texts without a speaker are choices and other texts that are not lines
+	TArray<FDialogueScriptLine> ScriptLines;
+	FDialogueScriptDerivedData::GetLines(UBlueprint::GetBlueprintFromClass(DialogueClass), ScriptLines);
+	for (int32 i=0; i<ScriptLines.Num(); i++)
+	{
+		if (ScriptLines.GetData()[i].Speaker.Len() > 0)
+		{
+			OutReport.ScriptLines.Add(ScriptLines.GetData()[i].Text.ToString());
+		}
+	}
+#endif //
+
+	TArray<int32> Prefix;
+	TArray<int32> Path;
+	TArray<int32> NumOptions;
+	FString ChoiceLog;
+	int64 iTotalLines = 0;
+
+	for (int32 iRun=0; iRun<Settings.MaxRuns; iRun++)
+	{
+		int32 iLines = 0;
+		ERunResult Result = PlayOnce(Prefix, Path, NumOptions, ChoiceLog, iLines, OutReport);
+		OutReport.NumRuns++;
+
+		switch (Result)
+		{
+		case ERunResult::Completed:
+			OutReport.NumCompleted++;
+			iTotalLines += iLines;
+			OutReport.LongestPath = FMath::Max(OutReport.LongestPath, iLines);
+			break;
+
+		case ERunResult::DeadEnd:
+			OutReport.NumDeadEnds++;
+			OutReport.DeadEnds.AddUnique(ChoiceLog.Len() > 0 ? ChoiceLog : TEXT("(start)"));
+			break;
+
+		case ERunResult::Truncated:
+			OutReport.NumTruncated++;
+			break;
+		}
+
+		if (Settings.Mode != EDialogueSimulationMode::DepthFirst)
+			continue;
+
+		//Next combination, last choice that has options left
+		int32 k = Path.Num() - 1;
+		while (k >= 0 && Path.GetData()[k] + 1 >= NumOptions.GetData()[k])
+		{
+			k--;
+		}
+
+		if (k < 0)
+		{
+			OutReport.bExhausted = true;
+			break;
+		}
+
+		Prefix.Reset(k + 1);
+		Prefix.Append(Path.GetData(), k);
+		Prefix.Add(Path.GetData()[k] + 1);
+	}
+
+	Manager->ClearDialogue();
+
+	OutReport.AveragePathLength = OutReport.NumCompleted > 0 ? (double)iTotalLines / OutReport.NumCompleted : 0.0;
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void SimulateDialogue(const TArray<FString> &Args)
+{
+	if (Args.Num() == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Usage: SimpleDialogue.Simulate <class path> [Random] [MaxRuns] [Seed]"));
+		return;
+	}
+
+	TSubclassOf<UDialogue> DialogueClass = UDialogue::LoadDialogue(TSoftClassPtr<UDialogue>(FSoftObjectPath(Args[0])));
+	if (!DialogueClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to load dialogue class \"%s\""), *Args[0]);
+		return;
+	}
+
+	FDialogueSimulationSettings Settings;
+	Settings.Mode = Args.Num() > 1 && Args[1].Equals(TEXT("Random"), ESearchCase::IgnoreCase) ? EDialogueSimulationMode::RandomWalk : EDialogueSimulationMode::DepthFirst;
+	Settings.MaxRuns = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : Settings.MaxRuns;
+	Settings.RandomSeed = Args.Num() > 3 ? FCString::Atoi(*Args[3]) : Settings.RandomSeed;
+
+	FDialogueSimulationReport Report;
+	FDialogueSimulator Simulator(DialogueClass, Settings);
+	Simulator.Run(Report);
+
+	UE_LOG(LogTemp, Display, TEXT("%s"), *Report.ToString());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand SimulateDialogueCommand(
+	TEXT("SimpleDialogue.Simulate"),
+	TEXT("Plays every path of a dialogue script without a game. Arguments: class path, optional Random, max runs and seed."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&SimulateDialogue));
+
+#endif //!UE_BUILD_SHIPPING
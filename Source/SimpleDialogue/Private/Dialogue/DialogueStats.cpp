@@ -0,0 +1,51 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueStats.h"
+
+DEFINE_STAT(STAT_DialogueManagerTick);
+DEFINE_STAT(STAT_DialogueContextRead);
+DEFINE_STAT(STAT_DialogueContextWrite);
+DEFINE_STAT(STAT_DialogueBroadcast);
+
+DEFINE_STAT(STAT_DialogueContextMemory);
+DEFINE_STAT(STAT_DialogueChoicesMemory);
+DEFINE_STAT(STAT_DialogueObjectMemory);
+
+DEFINE_STAT(STAT_DialogueActive);
+DEFINE_STAT(STAT_DialogueActiveBarks);
+DEFINE_STAT(STAT_DialogueLinesPerSecond);
+
+double FDialogueStats::WindowStart = 0.0;
+int32 FDialogueStats::WindowLines = 0;
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueStats::AddLine()
+{
+#if STATS
+	WindowLines++;
+	Update();
+#endif //STATS
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueStats::Update()
+{
+#if STATS
+	const double flNow = FPlatformTime::Seconds();
+	const double flElapsed = flNow - WindowStart;
+	if (flElapsed < 1.0)
+		return;
+
+	//Nothing was counted for a long time, the last window is meaningless
+	SET_DWORD_STAT(STAT_DialogueLinesPerSecond, flElapsed < 2.0 ? FMath::RoundToInt(WindowLines / flElapsed) : 0);
+
+	WindowStart = flNow;
+	WindowLines = 0;
+#endif //STATS
+}
@@ -0,0 +1,366 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueTelemetry.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Compression.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+
+bool FDialogueTelemetry::bRecording = false;
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static const TCHAR *GetTelemetryEventName(EDialogueTelemetryEvent InType)
+{
+	switch (InType)
+	{
+	case EDialogueTelemetryEvent::Line:				return TEXT("line");
+	case EDialogueTelemetryEvent::ChoiceOffered:	return TEXT("choice_offered");
+	case EDialogueTelemetryEvent::ChoicePicked:		return TEXT("choice_picked");
+	case EDialogueTelemetryEvent::Skip:				return TEXT("skip");
+	case EDialogueTelemetryEvent::ContextChange:	return TEXT("context");
+	}
+
+	return TEXT("unknown");
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void AppendJsonString(FString &OutJson, const FString &InString)
+{
+	OutJson += TEXT('"');
+	for (int32 i=0; i<InString.Len(); i++)
+	{
+		const TCHAR Char = InString.GetCharArray().GetData()[i];
+		if (Char == TEXT('"') || Char == TEXT('\\'))
+		{
+			OutJson += TEXT('\\');
+		}
+		else if (Char < 0x20)
+		{
+			OutJson += FString::Printf(TEXT("\\u%04x"), (int32)Char);
+			continue;
+		}
+
+		OutJson += Char;
+	}
+	OutJson += TEXT('"');
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueTelemetryFileSink::FDialogueTelemetryFileSink(const FString &InFilename, EDialogueTelemetryFormat InFormat)
+	: Format(InFormat)
+{
+	IPlatformFile &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(InFilename));
+
+	File = PlatformFile.OpenWrite(*InFilename, true);
+	if (!File)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open dialogue telemetry file %s"), *InFilename);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueTelemetryFileSink::~FDialogueTelemetryFileSink()
+{
+	Close();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FString FDialogueTelemetryFileSink::MakeFilename(EDialogueTelemetryFormat InFormat)
+{
+	return FPaths::ProjectSavedDir() / TEXT("SimpleDialogue") / TEXT("Telemetry") / FString::Printf(TEXT("%s.%s"), *FDateTime::Now().ToString(), InFormat == EDialogueTelemetryFormat::Binary ? TEXT("bin") : TEXT("ndjson"));
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryFileSink::Write(const TArray<FDialogueTelemetryRecord> &InRecords)
+{
+	if (!File || InRecords.Num() == 0)
+		return;
+
+	if (Format == EDialogueTelemetryFormat::Binary)
+	{
+		WriteBinary(InRecords);
+	}
+	else
+	{
+		WriteJson(InRecords);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryFileSink::Close()
+{
+	if (File)
+	{
+		File->Flush();
+		delete File;
+		File = NULL;
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryFileSink::WriteJson(const TArray<FDialogueTelemetryRecord> &InRecords)
+{
+	Json.Reset();
+
+	for (int32 i=0; i<InRecords.Num(); i++)
+	{
+		const FDialogueTelemetryRecord &Record = InRecords.GetData()[i];
+
+		Json += FString::Printf(TEXT("{\"time\":\"%s\",\"event\":\"%s\",\"script\":"), *FDateTime(Record.Time).ToIso8601(), GetTelemetryEventName(Record.Type));
+		AppendJsonString(Json, Record.Script.ToString());
+
+		if (Record.Type == EDialogueTelemetryEvent::ContextChange)
+		{
+			Json += TEXT(",\"tag\":");
+			AppendJsonString(Json, Record.Tag.ToString());
+			Json += TEXT(",\"actor\":");
+			AppendJsonString(Json, Record.ActorTag.ToString());
+			Json += FString::Printf(TEXT(",\"change\":%d,\"old\":%d,\"new\":%d"), Record.Index, Record.OldValue, Record.NewValue);
+		}
+		else
+		{
+			Json += TEXT(",\"key\":");
+			AppendJsonString(Json, Record.Key.IsNone() ? FString() : Record.Key.ToString());
+			Json += FString::Printf(TEXT(",\"index\":%d"), Record.Index);
+		}
+
+		Json += TEXT("}\n");
+	}
+
+	FTCHARToUTF8 Utf8(*Json, Json.Len());
+	File->Write((const uint8*)Utf8.Get(), Utf8.Length());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryFileSink::WriteBinary(const TArray<FDialogueTelemetryRecord> &InRecords)
+{
+	Uncompressed.Reset();
+	FMemoryWriter Writer(Uncompressed);
+
+	for (int32 i=0; i<InRecords.Num(); i++)
+	{
+		const FDialogueTelemetryRecord &Record = InRecords.GetData()[i];
+
+		int64 iTime = Record.Time;
+		uint8 iType = (uint8)Record.Type;
+		FString Script = Record.Script.ToString();
+		FString Key = Record.Key.IsNone() ? FString() : Record.Key.ToString();
+		int32 iIndex = Record.Index;
+		FString Tag = Record.Tag.ToString();
+		FString ActorTag = Record.ActorTag.ToString();
+		int32 iOldValue = Record.OldValue;
+		int32 iNewValue = Record.NewValue;
+
+		Writer << iTime << iType << Script << Key << iIndex << Tag << ActorTag << iOldValue << iNewValue;
+	}
+
+	int32 iCompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Uncompressed.Num());
+	Compressed.SetNumUninitialized(iCompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), iCompressedSize, Uncompressed.GetData(), Uncompressed.Num()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to compress %d dialogue telemetry records"), InRecords.Num());
+		return;
+	}
+
+	uint32 Header[5] = { BinaryMagic, BinaryVersion, (uint32)InRecords.Num(), (uint32)Uncompressed.Num(), (uint32)iCompressedSize };
+	File->Write((const uint8*)Header, sizeof(Header));
+	File->Write(Compressed.GetData(), iCompressedSize);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryMemorySink::Write(const TArray<FDialogueTelemetryRecord> &InRecords)
+{
+	FScopeLock ScopeLock(&Lock);
+	Records.Append(InRecords);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetryMemorySink::GetRecords(TArray<FDialogueTelemetryRecord> &OutRecords) const
+{
+	FScopeLock ScopeLock(&Lock);
+	OutRecords = Records;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueTelemetry &FDialogueTelemetry::Get()
+{
+	static FDialogueTelemetry Telemetry;
+	return Telemetry;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetry::StartRecording(TUniquePtr<IDialogueTelemetrySink> InSink)
+{
+	check(IsInGameThread());
+
+	StopRecording();
+
+	if (!InSink.IsValid())
+		return;
+
+	Sink = MoveTemp(InSink);
+
+	if (Buffer.Num() != Capacity)
+	{
+		Buffer.SetNum(Capacity);
+	}
+
+	WriteIndex.store(0);
+	ReadIndex.store(0);
+	NumDropped.store(0);
+	bStopping.store(false);
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("DialogueTelemetry"), 0, TPri_BelowNormal);
+	if (!Thread)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = NULL;
+		Sink.Reset();
+		return;
+	}
+
+	bRecording = true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetry::StopRecording()
+{
+	check(IsInGameThread());
+
+	if (!Thread)
+		return;
+
+	bRecording = false;
+
+	bStopping.store(true);
+	WakeEvent->Trigger();
+	Thread->WaitForCompletion();
+
+	delete Thread;
+	Thread = NULL;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = NULL;
+
+	Sink->Close();
+	Sink.Reset();
+
+	if (GetNumDropped() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Dialogue telemetry dropped %llu records, the flush thread fell behind"), GetNumDropped());
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+uint32 FDialogueTelemetry::Run()
+{
+	while (!bStopping.load())
+	{
+		WakeEvent->Wait(FTimespan::FromSeconds(FlushInterval));
+		Drain();
+	}
+
+	//Whatever was recorded before bRecording was cleared
+	Drain();
+	return 0;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTelemetry::Drain()
+{
+	const uint64 iRead = ReadIndex.load(std::memory_order_relaxed);
+	const uint64 iWrite = WriteIndex.load(std::memory_order_acquire);
+	if (iRead == iWrite)
+		return;
+
+	Batch.Reset((int32)(iWrite - iRead));
+	for (uint64 i=iRead; i<iWrite; i++)
+	{
+		Batch.Add(Buffer.GetData()[i & (Capacity - 1)]);
+	}
+
+	//Slots can be reused as soon as they are copied
+	ReadIndex.store(iWrite, std::memory_order_release);
+
+	Sink->Write(Batch);
+}
+
+#if !UE_BUILD_SHIPPING
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void StartTelemetry(const TArray<FString> &Args)
+{
+	const EDialogueTelemetryFormat Format = Args.Num() > 0 && Args[0].Equals(TEXT("Binary"), ESearchCase::IgnoreCase) ? EDialogueTelemetryFormat::Binary : EDialogueTelemetryFormat::NDJSON;
+	const FString Filename = FDialogueTelemetryFileSink::MakeFilename(Format);
+
+	FDialogueTelemetry::Get().StartRecording(MakeUnique<FDialogueTelemetryFileSink>(Filename, Format));
+	UE_LOG(LogTemp, Display, TEXT("Recording dialogue telemetry to %s"), *Filename);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void StopTelemetry(const TArray<FString> &Args)
+{
+	FDialogueTelemetry::Get().StopRecording();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand StartTelemetryCommand(
+	TEXT("SimpleDialogue.Telemetry.Start"),
+	TEXT("Records lines, choices, skips and context changes to Saved/SimpleDialogue/Telemetry. Optional argument: Binary for compressed batches instead of NDJSON."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&StartTelemetry));
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand StopTelemetryCommand(
+	TEXT("SimpleDialogue.Telemetry.Stop"),
+	TEXT("Flushes and closes the dialogue telemetry file."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&StopTelemetry));
+
+#endif //!UE_BUILD_SHIPPING
@@ -0,0 +1,174 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueTextCache.h"
+#include "Internationalization/StringTableCore.h"
+#include "Internationalization/StringTableRegistry.h"
+#include "Internationalization/TextInspector.h"
+#include "Internationalization/TextLocalizationManager.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextCache::Warm(FName InTableId)
+{
+	if (InTableId.IsNone())
+		return;
+
+	CheckRevision();
+
+	if (InTableId == TableId && bResolved)
+		return;
+
+	TableId = InTableId;
+	Resolve();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextCache::Reset()
+{
+	TableId = NAME_None;
+	bResolved = false;
+	KeyToEntry.Reset();
+	Entries.Reset();
+	LastText = FText::GetEmpty();
+	LastEntry = INDEX_NONE;
+	LastOther = FEntry();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextCache::CheckRevision()
+{
+	const uint16 iRevision = FTextLocalizationManager::Get().GetTextRevision();
+	if (iRevision == Revision)
+		return;
+
+	Revision = iRevision;
+
+	//Strings of the last text are stale too
+	LastText = FText::GetEmpty();
+	LastEntry = INDEX_NONE;
+	LastOther = FEntry();
+
+	if (bResolved)
+	{
+		Resolve();
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextCache::Resolve()
+{
+	KeyToEntry.Reset();
+	Entries.Reset();
+	Revision = FTextLocalizationManager::Get().GetTextRevision();
+	bResolved = true;
+
+	FStringTableConstPtr Table = FStringTableRegistry::Get().FindStringTable(TableId);
+	if (!Table.IsValid())
+		return;
+
+	Table->EnumerateSourceStrings([this](const FString &InKey, const FString &InSourceString)
+	{
+		KeyToEntry.Add(InKey, Entries.Num());
+		Entries.AddDefaulted_GetRef().Display = FText::FromStringTable(TableId, InKey).ToString();
+		return true;
+	});
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+int32 FDialogueTextCache::Find(const FText &InText)
+{
+	CheckRevision();
+
+	if (InText.IdenticalTo(LastText))
+		return LastEntry;
+
+	LastText = InText;
+	LastEntry = INDEX_NONE;
+
+	FName InTableId;
+	FString Key;
+	if (Entries.Num() > 0 && FTextInspector::GetTableIdAndKey(InText, InTableId, Key) && InTableId == TableId)
+	{
+		const int32 *pEntry = KeyToEntry.Find(Key);
+		if (pEntry)
+		{
+			LastEntry = *pEntry;
+			return LastEntry;
+		}
+	}
+
+	LastOther = FEntry();
+	LastOther.Display = InText.ToString();
+	return INDEX_NONE;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+const FString &FDialogueTextCache::GetDisplayString(const FText &InText)
+{
+	const int32 iEntry = Find(InText);
+	return iEntry != INDEX_NONE ? Entries.GetData()[iEntry].Display : LastOther.Display;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FVector2D FDialogueTextCache::GetSize(const FText &InText, const FSlateFontInfo &InFont)
+{
+	if (!FSlateApplication::IsInitialized())
+		return FVector2D::ZeroVector;
+
+	if (!MeasureFont.IsIdenticalTo(InFont))
+	{
+		MeasureFont = InFont;
+		for (int32 i=0; i<Entries.Num(); i++)
+		{
+			Entries.GetData()[i].bMeasured = false;
+		}
+		LastOther.bMeasured = false;
+	}
+
+	const int32 iEntry = Find(InText);
+	FEntry &Entry = iEntry != INDEX_NONE ? Entries.GetData()[iEntry] : LastOther;
+	if (!Entry.bMeasured)
+	{
+		Entry.Size = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(Entry.Display, MeasureFont);
+		Entry.bMeasured = true;
+	}
+
+	return Entry.Size;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+SIZE_T FDialogueTextCache::GetAllocatedSize() const
+{
+	SIZE_T Size = KeyToEntry.GetAllocatedSize() + Entries.GetAllocatedSize() + LastOther.Display.GetAllocatedSize();
+	for (auto It = KeyToEntry.CreateConstIterator(); It; ++It)
+	{
+		Size += It.Key().GetAllocatedSize();
+	}
+
+	for (int32 i=0; i<Entries.Num(); i++)
+	{
+		Size += Entries.GetData()[i].Display.GetAllocatedSize();
+	}
+
+	return Size;
+}
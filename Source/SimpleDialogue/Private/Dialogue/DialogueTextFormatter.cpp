@@ -0,0 +1,215 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueTextFormatter.h"
+#include "Internationalization/TextLocalizationManager.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueTextFormatter::SetArgument(const FString &InName, const FFormatArgumentValue &InValue)
+{
+	FFormatArgumentValue *pValue = Arguments.Find(InName);
+	if (pValue && pValue->IdenticalTo(InValue, ETextIdenticalModeFlags::DeepCompare))
+		return false;
+
+	Arguments.Add(InName, InValue);
+	ArgumentSerials.FindOrAdd(InName) = ++Serial;
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueTextFormatter::RemoveArgument(const FString &InName)
+{
+	if (Arguments.Remove(InName) == 0)
+		return false;
+
+	ArgumentSerials.FindOrAdd(InName) = ++Serial;
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueTextFormatter::OnContextChanged(const FGameplayTag &InTag)
+{
+	if (!UsedContextTags.Contains(InTag))
+		return false;
+
+	ContextSerials.FindOrAdd(InTag) = ++Serial;
+	return true;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextFormatter::Invalidate()
+{
+	InvalidateSerial = ++Serial;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextFormatter::Reset()
+{
+	Patterns.Reset();
+	UsedContextTags.Reset();
+	ContextSerials.Reset();
+	LastText = FText::GetEmpty();
+	LastFormatted = FText::GetEmpty();
+	LastSerial = 0;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTextFormatter::CheckRevision()
+{
+	const uint16 iRevision = FTextLocalizationManager::Get().GetTextRevision();
+	if (iRevision != Revision)
+	{
+		Reset();
+		Revision = iRevision;
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FDialogueTextFormatter::FPattern &FDialogueTextFormatter::FindOrAddPattern(const FText &InText)
+{
+	const FString &Display = InText.ToString();
+
+	FPattern *pPattern = Patterns.Find(Display);
+	if (pPattern)
+		return *pPattern;
+
+	if (Patterns.Num() >= MaxPatterns)
+	{
+		Patterns.Reset();
+		UsedContextTags.Reset();
+		ContextSerials.Reset();
+	}
+
+	FPattern &Pattern = Patterns.Add(Display);
+	Pattern.Format = FTextFormat(InText);
+	Pattern.Format.GetFormatArgumentNames(Pattern.ArgumentNames);
+
+	for (int32 i=0; i<Pattern.ArgumentNames.Num(); i++)
+	{
+		FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*Pattern.ArgumentNames.GetData()[i]), false);
+		if (Tag.IsValid())
+		{
+			Pattern.ContextTags.Add(Tag);
+			UsedContextTags.Add(Tag);
+		}
+	}
+
+	return Pattern;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+bool FDialogueTextFormatter::HasChangedSince(const FPattern &InPattern) const
+{
+	if (InPattern.Serial == 0 || InvalidateSerial > InPattern.Serial)
+		return true;
+
+	for (int32 i=0; i<InPattern.ArgumentNames.Num(); i++)
+	{
+		const uint32 *pSerial = ArgumentSerials.Find(InPattern.ArgumentNames.GetData()[i]);
+		if (pSerial && *pSerial > InPattern.Serial)
+			return true;
+	}
+
+	for (int32 i=0; i<InPattern.ContextTags.Num(); i++)
+	{
+		const uint32 *pSerial = ContextSerials.Find(InPattern.ContextTags.GetData()[i]);
+		if (pSerial && *pSerial > InPattern.Serial)
+			return true;
+	}
+
+	return false;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FText FDialogueTextFormatter::Format(const FText &InText)
+{
+	CheckRevision();
+
+	if (LastSerial == Serial && InText.IdenticalTo(LastText))
+		return LastFormatted;
+
+	LastText = InText;
+	LastSerial = Serial;
+
+	//Plain lines are never parsed, a backtick in them would be taken as an escape
+	int32 iBrace = INDEX_NONE;
+	if (!InText.ToString().FindChar(TEXT('{'), iBrace))
+	{
+		LastFormatted = InText;
+		return LastFormatted;
+	}
+
+	FPattern &Pattern = FindOrAddPattern(InText);
+
+	if (Pattern.ArgumentNames.Num() == 0)
+	{
+		LastFormatted = InText;
+		return LastFormatted;
+	}
+
+	if (HasChangedSince(Pattern))
+	{
+		FFormatNamedArguments LineArguments;
+		for (int32 i=0; i<Pattern.ArgumentNames.Num(); i++)
+		{
+			const FString &Name = Pattern.ArgumentNames.GetData()[i];
+
+			const FFormatArgumentValue *pValue = Arguments.Find(Name);
+			if (pValue)
+			{
+				LineArguments.Add(Name, *pValue);
+			}
+		}
+
+		int32 iValue = 0;
+		for (int32 i=0; i<Pattern.ContextTags.Num(); i++)
+		{
+			const FGameplayTag &Tag = Pattern.ContextTags.GetData()[i];
+			if (ContextResolver && ContextResolver(Tag, iValue))
+			{
+				LineArguments.FindOrAdd(Tag.ToString()) = iValue;
+			}
+		}
+
+		//Braces that don't name anything set are not arguments, the line is shown as written
+		Pattern.Formatted = LineArguments.Num() > 0 ? FText::Format(Pattern.Format, MoveTemp(LineArguments)) : InText;
+	}
+
+	Pattern.Serial = Serial;
+
+	LastFormatted = Pattern.Formatted;
+	return LastFormatted;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+SIZE_T FDialogueTextFormatter::GetAllocatedSize() const
+{
+	SIZE_T Size = Arguments.GetAllocatedSize() + UsedContextTags.GetAllocatedSize() + Patterns.GetAllocatedSize() + ArgumentSerials.GetAllocatedSize() + ContextSerials.GetAllocatedSize();
+	for (auto It = Patterns.CreateConstIterator(); It; ++It)
+	{
+		Size += It.Key().GetAllocatedSize() + It.Value().ArgumentNames.GetAllocatedSize() + It.Value().ContextTags.GetAllocatedSize();
+	}
+
+	return Size;
+}
@@ -0,0 +1,419 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueTextPinIndex.h"
+
+#if WITH_EDITOR
+
+#include "Engine/Blueprint.h"
+#include "Internationalization/StringTable.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Algo/StableSort.h"
+
+//=================================================================
+//
+//=================================================================
+FDialogueTextPinIndex &FDialogueTextPinIndex::Get()
+{
+	static FDialogueTextPinIndex Index;
+	return Index;
+}
+
+//=================================================================
+//
+//=================================================================
+FDialogueTextPinIndex::FDialogueTextPinIndex()
+{
+	//Lives until exit, never removed
+	FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FDialogueTextPinIndex::OnObjectModified);
+}
+
+//=================================================================
+//
+//=================================================================
+FString FDialogueTextPinIndex::GetTextIdentity(const FText &InText)
+{
+	if (InText.IsFromStringTable())
+	{
+		FName TableId;
+		FString Key;
+		FTextInspector::GetTableIdAndKey(InText, TableId, Key);
+		return FString::Printf(TEXT("%s|%s"), *TableId.ToString(), *Key);
+	}
+
+	return InText.ToString();
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::GatherTextPinsFromGraph(const TArray<class UEdGraph *> &Graphs, TArray<UEdGraphPin*> &OutPins)
+{
+	//Go through different graphs
+	for (int32 i=0; i<Graphs.Num(); i++)
+	{
+		//
+		class UEdGraph *pGraph = Graphs.GetData()[i];
+		if (!pGraph)
+			continue;
+
+		//Go through graph nodes
+		for (int32 j=0; j<pGraph->Nodes.Num(); j++)
+		{
+			//
+			class UEdGraphNode *pNode = pGraph->Nodes.GetData()[j];
+			if (!pNode)
+				continue;
+
+			//Go through pins in node
+			for (int32 k=0; k<pNode->Pins.Num(); k++)
+			{
+				//
+				class UEdGraphPin *pPin = pNode->Pins.GetData()[k];
+				if (!pPin)
+					continue;
+
+				//
+				if (pPin->LinkedTo.Num() > 0)
+					continue;
+
+				if (pPin->Direction != EEdGraphPinDirection::EGPD_Input)
+					continue;
+
+				//Make sure correct type
+				static const FName Name_Text = TEXT("text");
+				if (pPin->PinType.PinCategory != Name_Text)
+				{
+					continue;
+				}
+
+				OutPins.Add(pPin);
+			}
+		}
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::GatherTextPins(class UBlueprint *InBlueprint, TArray<UEdGraphPin*> &OutPins)
+{
+	if (!IsValid(InBlueprint))
+		return;
+
+	GatherTextPinsFromGraph(InBlueprint->UbergraphPages, OutPins);
+	GatherTextPinsFromGraph(InBlueprint->FunctionGraphs, OutPins);
+	GatherTextPinsFromGraph(InBlueprint->MacroGraphs, OutPins);
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::Unbind(class UBlueprint *InBlueprint, FEntry &Entry)
+{
+	for (int32 i=0; i<Entry.GraphHandles.Num(); i++)
+	{
+		class UEdGraph *pGraph = Entry.GraphHandles.GetData()[i].Key.Get();
+		if (pGraph)
+		{
+			pGraph->RemoveOnGraphChangedHandler(Entry.GraphHandles.GetData()[i].Value);
+		}
+	}
+	Entry.GraphHandles.Reset();
+
+	if (InBlueprint)
+	{
+		InBlueprint->OnChanged().Remove(Entry.ChangedHandle);
+		InBlueprint->OnCompiled().Remove(Entry.CompiledHandle);
+	}
+
+	Entry.ChangedHandle.Reset();
+	Entry.CompiledHandle.Reset();
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::Build(class UBlueprint *InBlueprint, FEntry &Entry)
+{
+	Unbind(InBlueprint, Entry);
+
+	Entry.Texts.Reset();
+	Entry.Pins.Reset();
+	Entry.IdentityToPin.Reset();
+	Entry.DisplayStringToPin.Reset();
+
+	TArray<UEdGraphPin*> Pins;
+	GatherTextPins(InBlueprint, Pins);
+
+	Entry.Tree = MakeShared<FDialogueScriptTree>();
+	FDialogueScriptTree::Build(InBlueprint, *Entry.Tree);
+
+	//Story order first, pins that are never reached keep their graph order after those
+	TMap<const UEdGraphPin*, int32> StoryOrder;
+	Entry.Tree->Visit([&StoryOrder](const FDialogueScriptItem &Item, int32 Depth)
+	{
+		const class UEdGraphPin *pPin = Item.TextPin.Get();
+		if (pPin)
+		{
+			StoryOrder.FindOrAdd(pPin, StoryOrder.Num());
+		}
+	});
+
+	if (StoryOrder.Num() > 0)
+	{
+		Algo::StableSortBy(Pins, [&StoryOrder](const UEdGraphPin *pPin)
+		{
+			const int32 *pOrder = StoryOrder.Find(pPin);
+			return pOrder ? *pOrder : MAX_int32;
+		});
+	}
+
+	Entry.Texts.Reserve(Pins.Num());
+	Entry.Pins.Reserve(Pins.Num());
+
+	for (int32 i=0; i<Pins.Num(); i++)
+	{
+		class UEdGraphPin *pPin = Pins.GetData()[i];
+		const FText &Text = pPin->DefaultTextValue;
+
+		Entry.Texts.Add(Text);
+		Entry.Pins.Add(FEdGraphPinReference(pPin));
+
+		//First pin wins, same as the old linear search
+		if (Text.IsFromStringTable())
+		{
+			Entry.IdentityToPin.FindOrAdd(GetTextIdentity(Text), i);
+		}
+
+		Entry.DisplayStringToPin.FindOrAdd(Text.ToString(), i);
+	}
+
+	//Listen for changes so that we know when to throw this away
+	TWeakObjectPtr<UBlueprint> WeakBlueprint = InBlueprint;
+
+	TArray<class UEdGraph*> Graphs;
+	InBlueprint->GetAllGraphs(Graphs);
+	for (int32 i=0; i<Graphs.Num(); i++)
+	{
+		class UEdGraph *pGraph = Graphs.GetData()[i];
+		if (!pGraph)
+			continue;
+
+		FDelegateHandle Handle = pGraph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateRaw(this, &FDialogueTextPinIndex::OnGraphChanged, WeakBlueprint));
+		Entry.GraphHandles.Add(TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>(pGraph, Handle));
+	}
+
+	Entry.ChangedHandle = InBlueprint->OnChanged().AddRaw(this, &FDialogueTextPinIndex::OnBlueprintChanged);
+	Entry.CompiledHandle = InBlueprint->OnCompiled().AddRaw(this, &FDialogueTextPinIndex::OnBlueprintChanged);
+
+	Entry.bIsDirty = false;
+}
+
+//=================================================================
+//
+//=================================================================
+FDialogueTextPinIndex::FEntry &FDialogueTextPinIndex::FindOrBuild(class UBlueprint *InBlueprint)
+{
+	if (!Entries.Contains(InBlueprint))
+	{
+		RemoveStaleEntries();
+	}
+
+	FEntry &Entry = Entries.FindOrAdd(InBlueprint);
+	if (Entry.bIsDirty)
+	{
+		Build(InBlueprint, Entry);
+	}
+
+	return Entry;
+}
+
+//=================================================================
+//
+//=================================================================
+class UEdGraphPin *FDialogueTextPinIndex::ResolveAndValidate(FEntry &Entry, int32 Index, const FText &InText, bool bIdentity) const
+{
+	class UEdGraphPin *pPin = Entry.Pins.GetData()[Index].Get();
+	if (!pPin)
+		return NULL;
+
+	//Pin default values can be edited without the graph telling us
+	if (bIdentity)
+	{
+		if (!pPin->DefaultTextValue.IsFromStringTable() || GetTextIdentity(pPin->DefaultTextValue) != GetTextIdentity(InText))
+			return NULL;
+	}
+	else if (!pPin->DefaultTextValue.ToString().Equals(InText.ToString()))
+	{
+		return NULL;
+	}
+
+	return pPin;
+}
+
+//=================================================================
+//
+//=================================================================
+class UEdGraphPin *FDialogueTextPinIndex::FindPin(class UBlueprint *InBlueprint, const FText &InText)
+{
+	if (!IsValid(InBlueprint))
+		return NULL;
+
+	for (int32 iAttempt=0; iAttempt<2; iAttempt++)
+	{
+		FEntry &Entry = FindOrBuild(InBlueprint);
+
+		bool bStale = false;
+
+		if (InText.IsFromStringTable())
+		{
+			const int32 *pIndex = Entry.IdentityToPin.Find(GetTextIdentity(InText));
+			if (pIndex)
+			{
+				class UEdGraphPin *pPin = ResolveAndValidate(Entry, *pIndex, InText, true);
+				if (pPin)
+					return pPin;
+
+				bStale = true;
+			}
+		}
+
+		const int32 *pIndex = Entry.DisplayStringToPin.Find(InText.ToString());
+		if (pIndex)
+		{
+			class UEdGraphPin *pPin = ResolveAndValidate(Entry, *pIndex, InText, false);
+			if (pPin)
+				return pPin;
+
+			bStale = true;
+		}
+
+		//Not in the blueprint, changes to it would have marked the index dirty
+		if (!bStale)
+			return NULL;
+
+		//Pin found but its value changed, rebuild once and try again
+		Entry.bIsDirty = true;
+	}
+
+	return NULL;
+}
+
+//=================================================================
+//
+//=================================================================
+const TArray<FText> &FDialogueTextPinIndex::GetTexts(class UBlueprint *InBlueprint)
+{
+	static const TArray<FText> Empty;
+	if (!IsValid(InBlueprint))
+		return Empty;
+
+	return FindOrBuild(InBlueprint).Texts;
+}
+
+//=================================================================
+//
+//=================================================================
+const TArray<FEdGraphPinReference> &FDialogueTextPinIndex::GetPins(class UBlueprint *InBlueprint)
+{
+	static const TArray<FEdGraphPinReference> Empty;
+	if (!IsValid(InBlueprint))
+		return Empty;
+
+	return FindOrBuild(InBlueprint).Pins;
+}
+
+//=================================================================
+//
+//=================================================================
+TSharedRef<const FDialogueScriptTree> FDialogueTextPinIndex::GetScriptTree(class UBlueprint *InBlueprint)
+{
+	if (!IsValid(InBlueprint))
+		return MakeShared<FDialogueScriptTree>();
+
+	return FindOrBuild(InBlueprint).Tree.ToSharedRef();
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::Invalidate(class UBlueprint *InBlueprint)
+{
+	FEntry *pEntry = Entries.Find(InBlueprint);
+	if (pEntry)
+	{
+		pEntry->bIsDirty = true;
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::RemoveStaleEntries()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			Unbind(NULL, It.Value());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::InvalidateAll()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		Unbind(It.Key().Get(), It.Value());
+	}
+
+	Entries.Reset();
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::OnGraphChanged(const FEdGraphEditAction &InAction, TWeakObjectPtr<class UBlueprint> InBlueprint)
+{
+	Invalidate(InBlueprint.Get());
+}
+
+//=================================================================
+//
+//=================================================================
+void FDialogueTextPinIndex::OnBlueprintChanged(class UBlueprint *InBlueprint)
+{
+	Invalidate(InBlueprint);
+}
+
+//=================================================================
+// Called for every Modify in the editor, has to stay cheap
+//=================================================================
+void FDialogueTextPinIndex::OnObjectModified(class UObject *InObject)
+{
+	if (Entries.Num() == 0 || !InObject)
+		return;
+
+	//Display strings of string table texts changed
+	if (InObject->IsA<UStringTable>())
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			It.Value().bIsDirty = true;
+		}
+		return;
+	}
+
+	if (InObject->IsA<UEdGraphNode>() || InObject->IsA<UEdGraph>())
+	{
+		Invalidate(InObject->GetTypedOuter<UBlueprint>());
+	}
+}
+
+#endif //WITH_EDITOR
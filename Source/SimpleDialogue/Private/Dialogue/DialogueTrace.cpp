@@ -0,0 +1,166 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Dialogue/DialogueTrace.h"
+
+#if SIMPLEDIALOGUE_TRACE_ENABLED
+
+#include "Trace/Trace.inl"
+#include "Dialogue/Dialogue.h"
+#include "GameplayTagContainer.h"
+
+UE_TRACE_CHANNEL_DEFINE(SimpleDialogueChannel)
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, Speak)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, WaitForActivation)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, SpeakContext)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, Line)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, Speaker)
+	UE_TRACE_EVENT_FIELD(float, Duration)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, VoiceOver)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, CustomName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, Choice)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, Link)
+	UE_TRACE_EVENT_FIELD(int32, NumChoices)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Function)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, Select)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, Index)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Function)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, Execute)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, Link)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Function)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SimpleDialogue, ContextChange)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, Type)
+	UE_TRACE_EVENT_FIELD(int32, OldValue)
+	UE_TRACE_EVENT_FIELD(int32, NewValue)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Tag)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorTag)
+UE_TRACE_EVENT_END()
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FString GetTraceClassName(const class UDialogue *InDialogue)
+{
+	return InDialogue ? InDialogue->GetClass()->GetName() : FString();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputSpeak(const class UClass *InClass, const FGameplayTag &InSpeakContext, bool bInWaitForActivation)
+{
+	const FString Class = InClass ? InClass->GetName() : FString();
+	const FString SpeakContext = InSpeakContext.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, Speak, SimpleDialogueChannel)
+		<< Speak.Cycle(FPlatformTime::Cycles64())
+		<< Speak.WaitForActivation(bInWaitForActivation ? 1 : 0)
+		<< Speak.Class(*Class, Class.Len())
+		<< Speak.SpeakContext(*SpeakContext, SpeakContext.Len());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputLine(const class UDialogue *InDialogue, uint8 InSpeaker, const FGameplayTag &InVoiceOver, const FGameplayTag &InCustomName, float InDuration)
+{
+	const FString Class = GetTraceClassName(InDialogue);
+	const FString VoiceOver = InVoiceOver.ToString();
+	const FString CustomName = InCustomName.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, Line, SimpleDialogueChannel)
+		<< Line.Cycle(FPlatformTime::Cycles64())
+		<< Line.Speaker(InSpeaker)
+		<< Line.Duration(InDuration)
+		<< Line.Class(*Class, Class.Len())
+		<< Line.VoiceOver(*VoiceOver, VoiceOver.Len())
+		<< Line.CustomName(*CustomName, CustomName.Len());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputChoice(const class UDialogue *InDialogue, FName InFunction, int32 InLink, int32 InNumChoices)
+{
+	const FString Class = GetTraceClassName(InDialogue);
+	const FString Function = InFunction.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, Choice, SimpleDialogueChannel)
+		<< Choice.Cycle(FPlatformTime::Cycles64())
+		<< Choice.Link(InLink)
+		<< Choice.NumChoices(InNumChoices)
+		<< Choice.Class(*Class, Class.Len())
+		<< Choice.Function(*Function, Function.Len());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputSelect(const class UDialogue *InDialogue, int32 InIndex, FName InFunction)
+{
+	const FString Class = GetTraceClassName(InDialogue);
+	const FString Function = InFunction.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, Select, SimpleDialogueChannel)
+		<< Select.Cycle(FPlatformTime::Cycles64())
+		<< Select.Index(InIndex)
+		<< Select.Class(*Class, Class.Len())
+		<< Select.Function(*Function, Function.Len());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputExecute(const class UDialogue *InDialogue, FName InFunction, int32 InLink)
+{
+	const FString Class = GetTraceClassName(InDialogue);
+	const FString Function = InFunction.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, Execute, SimpleDialogueChannel)
+		<< Execute.Cycle(FPlatformTime::Cycles64())
+		<< Execute.Link(InLink)
+		<< Execute.Class(*Class, Class.Len())
+		<< Execute.Function(*Function, Function.Len());
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void FDialogueTrace::OutputContextChange(uint8 InType, const FGameplayTag &InTag, const FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue)
+{
+	const FString Tag = InTag.ToString();
+	const FString ActorTag = InActorTag.ToString();
+
+	UE_TRACE_LOG(SimpleDialogue, ContextChange, SimpleDialogueChannel)
+		<< ContextChange.Cycle(FPlatformTime::Cycles64())
+		<< ContextChange.Type(InType)
+		<< ContextChange.OldValue(InOldValue)
+		<< ContextChange.NewValue(InNewValue)
+		<< ContextChange.Tag(*Tag, Tag.Len())
+		<< ContextChange.ActorTag(*ActorTag, ActorTag.Len());
+}
+
+#endif //SIMPLEDIALOGUE_TRACE_ENABLED
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SimpleDialogue.h"
+#include "Dialogue/DialogueTelemetry.h"
+#include "Dialogue/DialoguePacing.h"
 
 #define LOCTEXT_NAMESPACE "FSimpleDialogueModule"
 
@@ -13,6 +15,17 @@ void FSimpleDialogueModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	//Flush thread has to finish before the module goes away
+	FDialogueTelemetry::Get().StopRecording();
+
+#if SIMPLEDIALOGUE_PACING
+	//Playtest sessions keep their line timing for the pacing report
+	if (!FDialoguePacing::Get().IsEmpty())
+	{
+		FDialoguePacing::Get().Flush(FDialoguePacing::MakeFilename());
+	}
+#endif //
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,87 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Widgets/DialogueBoxWidget.h"
+#include "Dialogue/DialogueManager.h"
+#include "Dialogue/Dialogue.h"
+#include "Components/TextBlock.h"
+#include "Components/ProgressBar.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueBoxWidget::NativeOnDialogueUpdated(EDialogueDirty InFlags)
+{
+	UDialogueManager *pManager = GetManager();
+	if (!IsValid(pManager))
+		return;
+
+	const UDialogue *pDialogue = pManager->GetDialogue();
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Text))
+	{
+		const FText Text = pManager->GetText();
+		if (DialogueText)
+		{
+			DialogueText->SetText(Text);
+		}
+
+		OnTextChanged(Text);
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Speaker))
+	{
+		OnSpeakerChanged(pManager->GetSpeaker());
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Expression))
+	{
+		OnExpressionChanged(pManager->GetSpeaker(), IsValid(pDialogue) ? pDialogue->GetExpression() : EDialogueExpression::None);
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Choices | EDialogueDirty::Page))
+	{
+		OnChoicesChanged();
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Hovered))
+	{
+		OnHoveredChoiceChanged(IsValid(pDialogue) ? pDialogue->GetHoveredChoice() : INDEX_NONE);
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Pause))
+	{
+		OnPauseChanged(pManager->IsPaused());
+	}
+
+	if (EnumHasAnyFlags(InFlags, EDialogueDirty::Time))
+	{
+		const bool bHasDuration = pManager->HasDuration();
+		if (TimeBar)
+		{
+			TimeBar->SetVisibility(bHasDuration ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+		}
+
+		OnTimeChanged(bHasDuration);
+	}
+
+	Super::NativeOnDialogueUpdated(InFlags);
+}
+
+//==============================================================================================================
+// Time moves every frame, polled here instead of sending an update per frame
+//==============================================================================================================
+void UDialogueBoxWidget::NativeTick(const FGeometry &MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (TimeBar && TimeBar->GetVisibility() != ESlateVisibility::Collapsed)
+	{
+		UDialogueManager *pManager = GetManager();
+		if (IsValid(pManager) && pManager->HasDuration())
+		{
+			TimeBar->SetPercent(pManager->GetTimeFraction());
+		}
+	}
+}
@@ -12,15 +12,30 @@ void UDialogueWidget::Setup(class UDialogueManager *InManager)
 {
 	if (IsValid(InManager) && Manager.Get() != InManager)
 	{
+		if (IsValid(Manager.Get()))
+		{
+			Manager->OnDialogueUpdatedNative.Remove(UpdatedHandle);
+		}
+
 		Manager = InManager;
 
-		InManager->OnDialogueUpdated.AddDynamic(this, &UDialogueWidget::OnUpdate);
+		UpdatedHandle = InManager->OnDialogueUpdatedNative.AddUObject(this, &UDialogueWidget::NativeOnDialogueUpdated);
 
 		OnSetup();
-		OnUpdate();
+
+		//WasUpdated has to see the flags in OnUpdate the same as in a broadcast update
+		InManager->CallWithUpdateFlags(EDialogueDirty::All, [this]() { NativeOnDialogueUpdated(EDialogueDirty::All); });
 	}
 }
 
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueWidget::NativeOnDialogueUpdated(EDialogueDirty InFlags)
+{
+	OnUpdate();
+}
+
 //==============================================================================================================
 //
 //==============================================================================================================
@@ -28,9 +43,12 @@ void UDialogueWidget::NativeDestruct()
 {
 	if (IsValid(Manager.Get()))
 	{
+		Manager->OnDialogueUpdatedNative.Remove(UpdatedHandle);
 		Manager->ClearAllEvents(this);
 	}
 
+	UpdatedHandle.Reset();
+
 	Super::NativeDestruct();
 
 	Manager = NULL;
@@ -7,6 +7,7 @@
 #include "Engine/DataAsset.h"
 #include "DialogueChoice.h"
 #include "GameplayTagContainer.h"
+#include "Dialogue/DialoguePacing.h"
 #include "Dialogue.generated.h"
 
 //=============================================================================================================================================================================================================
@@ -205,6 +206,14 @@ private:
 	UPROPERTY(SaveGame)
 	float Box_Time = 0;
 
+#if SIMPLEDIALOGUE_PACING
+	//Seconds the current line has been on screen, not counting pauses
+	float Box_Shown = 0;
+#endif //
+
+	//String table key of the current line, only set while telemetry or pacing is recording
+	FName Box_TelemetryKey;
+
 	//=============================================================================================================================================================================================================
 	// DIALOGUE CHOICES
 	//=============================================================================================================================================================================================================
@@ -331,8 +340,17 @@ public:
 
 #endif
 
+public:
+
+	//Id of StringTable, kept in cooked builds for FDialogueTextCache
+	FORCEINLINE FName GetStringTableId() const { return StringTableId; }
+
 private:
 
+	//Set from StringTable when saved
+	UPROPERTY()
+	FName StringTableId;
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(EditAnywhere, Category="String Table")
 	TSoftObjectPtr<class UStringTable> StringTable;
@@ -347,6 +365,12 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void GetEveryoneInvolved(TArray<class AActor*> &OutActors);
 
+	//Bytes held by this instance, see SimpleDialogue.MemReport
+	void GetMemoryUsage(struct FDialogueMemoryUsage &OutUsage) const;
+
+	//
+	virtual void GetResourceSizeEx(FResourceSizeEx &CumulativeResourceSize) override;
+
 	//=============================================================================================================================================================================================================
 	//
 	//=============================================================================================================================================================================================================
@@ -465,6 +489,9 @@ public:
 
 	//
 	void GenerateNode(const FString &InString, float InDuration, int32 Index, bool HasNext, int32 &PinNum, FString &OutString, FString &PreviousSpeaker);
+
+	//Creates DialogueBox nodes straight into the event graph in one transaction. Returns number of nodes created
+	int32 GenerateNodesInGraph(const TArray<FString> &InLines, float InDuration);
 	bool ParseNodeToString(const FString& NodeString, FString& OutLine);
 
 	//
@@ -498,6 +525,26 @@ public:
 	UPROPERTY(EditAnywhere, Category="Clipboard")
 	bool GenerateNodesFromTextsAndCopyToClipboard;
 
+	//Create nodes from ClipboardTexts directly into the event graph without going through the clipboard
+	UPROPERTY(EditAnywhere, Category="Clipboard")
+	bool GenerateNodesFromTextsIntoGraph;
+
+	//Text file with one line of dialogue per line
+	UPROPERTY(EditAnywhere, Category="Import", meta=(FilePathFilter="txt"))
+	FFilePath ImportScriptFile;
+
+	//Create nodes from ImportScriptFile directly into the event graph
+	UPROPERTY(EditAnywhere, Category="Import")
+	bool GenerateNodesFromScriptFile;
+
+	//
+	UPROPERTY(EditAnywhere, Category="Export", meta=(FilePathFilter="txt"))
+	FFilePath ExportScriptFile;
+
+	//Write the whole graph in execution order to ExportScriptFile, including choices and branches
+	UPROPERTY(EditAnywhere, Category="Export")
+	bool ExportNodesToScriptFile;
+
 	//Resets every parameter in graphs that is titled "Duration" to the GenerateDefaultDuration value
 	UPROPERTY(EditAnywhere, Category="Reset")
 	bool ResetTimeInAllNodes;
@@ -45,7 +45,17 @@ struct FSavedContextMap
 #define FContextMapType TMap<FGameplayTag, int32>
 
 //==============================================================================================================
-// 
+// Copy of all context in a dialogue manager
+//==============================================================================================================
+struct FDialogueContextSnapshot
+{
+	FContextMapType GlobalContext;
+	TMap<FGameplayTag, FSavedContextMap> ActorContext;
+};
+
+//==============================================================================================================
+// Properties can set meta=(ContextRole="Require"), "Disallow" or "Change" to choose how the editor shows
+// the value. Without it the role is guessed from the property name
 //==============================================================================================================
 USTRUCT(BlueprintType)
 struct FContextAndValue
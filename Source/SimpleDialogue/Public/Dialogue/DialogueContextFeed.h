@@ -0,0 +1,152 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+//Context changes are only recorded for debugging tools
+#ifndef SIMPLEDIALOGUE_CONTEXT_FEED
+#define SIMPLEDIALOGUE_CONTEXT_FEED !UE_BUILD_SHIPPING
+#endif //
+
+//==============================================================================================================
+//
+//==============================================================================================================
+enum class EDialogueContextChange : uint8
+{
+	Set,
+	Remove,
+
+	//Every context of the actor was removed, Tag is empty
+	Clear,
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct FDialogueContextChange
+{
+	FGameplayTag Tag;
+
+	//Empty for global context
+	FGameplayTag ActorTag;
+
+	int32 OldValue = 0;
+	int32 NewValue = 0;
+
+	//FPlatformTime::Seconds
+	double Time = 0.0;
+
+	EDialogueContextChange Type = EDialogueContextChange::Set;
+};
+
+//==============================================================================================================
+// Fixed size ring buffer of context changes. Readers keep their own cursor and read everything after it, so
+// nothing has to copy or compare the context maps. If a reader falls more than the capacity behind the oldest
+// changes are lost and Read returns false, the reader should take a full copy of the context again.
+//
+// Cursors only ever grow. Changes.GetData()[0] is the change at Base until the buffer wraps, so a cursor maps to
+// slot (Cursor - Base) % Capacity. Invalidate empties the buffer and moves Base past every cursor handed out.
+//
+// Game thread only.
+//==============================================================================================================
+class FDialogueContextFeed
+{
+public:
+
+	static constexpr int32 Capacity = 16384;
+
+	//
+	void Push(const FDialogueContextChange &InChange);
+
+	//Cursor of the next change to be pushed
+	FORCEINLINE uint64 GetHead() const { return Head; }
+
+	//Cursor of the oldest change still in the buffer
+	FORCEINLINE uint64 GetTail() const { return Head - Changes.Num(); }
+
+	//Appends changes after InOutCursor and moves the cursor to the head. Returns false if some were lost
+	bool Read(uint64 &InOutCursor, TArray<FDialogueContextChange> &OutChanges) const;
+
+	//
+	void Reset();
+
+	//Every reader loses its place and has to take a full copy, for when the whole context is replaced
+	void Invalidate();
+
+private:
+
+	TArray<FDialogueContextChange> Changes;
+	uint64 Head = 0;
+
+	//Cursor of the first change pushed since the last Reset or Invalidate
+	uint64 Base = 0;
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE void FDialogueContextFeed::Push(const FDialogueContextChange &InChange)
+{
+	if (Changes.Num() < Capacity)
+	{
+		Changes.Add(InChange);
+	}
+	else
+	{
+		Changes.GetData()[(Head - Base) % Capacity] = InChange;
+	}
+
+	Head++;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE bool FDialogueContextFeed::Read(uint64 &InOutCursor, TArray<FDialogueContextChange> &OutChanges) const
+{
+	bool bComplete = true;
+
+	//Overwritten or invalidated already
+	const uint64 Tail = GetTail();
+	if (InOutCursor < Tail || InOutCursor > Head)
+	{
+		InOutCursor = Tail;
+		bComplete = false;
+	}
+
+	const int32 iCount = (int32)FMath::Min<uint64>(Head - InOutCursor, Changes.Num());
+
+	OutChanges.Reserve(OutChanges.Num() + iCount);
+	for (int32 i=0; i<iCount; i++)
+	{
+		OutChanges.Add(Changes.GetData()[(InOutCursor + i - Base) % Capacity]);
+	}
+
+	InOutCursor = Head;
+	return bComplete;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE void FDialogueContextFeed::Reset()
+{
+	Changes.Reset();
+	Head = 0;
+	Base = 0;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE void FDialogueContextFeed::Invalidate()
+{
+	//Skipping one cursor makes readers that were up to date fail too
+	Changes.Reset();
+	Head++;
+	Base = Head;
+}
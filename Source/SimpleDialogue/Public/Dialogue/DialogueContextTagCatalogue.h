@@ -0,0 +1,112 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+//==============================================================================================================
+// Every context tag under the roots in UDialogueSettings, sorted by name. Built on first use and thrown away
+// when the gameplay tag tree changes.
+//
+// The index of a tag in the sorted array is its id. Ids are dense, 0 to GetNum() - 1, and stay the same until the
+// tag tree or the configured roots change, so they must not be saved.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueContextTagCatalogue
+{
+public:
+
+	//
+	static FDialogueContextTagCatalogue &Get();
+
+	//
+	const TArray<FGameplayTag> &GetTags();
+
+	//
+	int32 GetNum();
+
+	//
+	const FGameplayTag &GetTag(int32 InId);
+
+	//INDEX_NONE if not a context tag
+	int32 FindId(const FGameplayTag &InTag);
+
+	//Increases every time the catalogue is rebuilt, ids from an older serial are stale
+	uint32 GetSerial();
+
+	//
+	void Invalidate();
+
+private:
+
+	//
+	void Build();
+
+	//
+	void ConditionalBuild();
+
+	TArray<FGameplayTag> Tags;
+	TMap<FGameplayTag, int32> TagToId;
+	uint32 Serial = 0;
+	bool bIsDirty = true;
+	bool bIsBound = false;
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE void FDialogueContextTagCatalogue::ConditionalBuild()
+{
+	if (bIsDirty)
+	{
+		Build();
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE const TArray<FGameplayTag> &FDialogueContextTagCatalogue::GetTags()
+{
+	ConditionalBuild();
+	return Tags;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE int32 FDialogueContextTagCatalogue::GetNum()
+{
+	ConditionalBuild();
+	return Tags.Num();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE const FGameplayTag &FDialogueContextTagCatalogue::GetTag(int32 InId)
+{
+	ConditionalBuild();
+	return Tags.IsValidIndex(InId) ? Tags.GetData()[InId] : FGameplayTag::EmptyTag;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE int32 FDialogueContextTagCatalogue::FindId(const FGameplayTag &InTag)
+{
+	ConditionalBuild();
+	const int32 *pId = TagToId.Find(InTag);
+	return pId ? *pId : INDEX_NONE;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE uint32 FDialogueContextTagCatalogue::GetSerial()
+{
+	ConditionalBuild();
+	return Serial;
+}
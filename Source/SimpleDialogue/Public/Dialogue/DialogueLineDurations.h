@@ -0,0 +1,123 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DialogueLineDurations.generated.h"
+
+//==============================================================================================================
+// String table line the durations are stored for
+//==============================================================================================================
+USTRUCT()
+struct FDialogueLineDurationsKey
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TableId;
+
+	UPROPERTY()
+	FName Key;
+};
+
+//==============================================================================================================
+// Reading length of every string table line in one culture
+//==============================================================================================================
+USTRUCT()
+struct FDialogueCultureLineDurations
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Durations")
+	FString Culture;
+
+	//Letters in quarters, same index as UDialogueLineDurations::Lines
+	UPROPERTY()
+	TArray<uint16> Letters;
+};
+
+//==============================================================================================================
+// Line lengths precomputed for every cooked culture, so UDialogueManager::GetTextDuration doesn't have to build
+// the localized string of every line it shows.
+//
+// Lengths are in letters and not seconds, TimePerLetter, AdditionalTextTime and MinimumTextTime of the dialogue
+// manager are still applied at runtime and can be tuned without rebuilding. A letter is one grapheme cluster, so
+// combining marks and surrogate pairs count once, and glyphs of languages written without spaces count as
+// WideGlyphLetters. Plain ASCII gives the same length as FString::Len.
+//
+// Rebuilt by the editor whenever the asset is saved, including when it is cooked. The asset also keeps a hash of
+// every string table it was built from, in the editor the manager checks them when it loads the asset and rebuilds
+// with a warning if a table was edited since.
+//
+// Lines are looked up by the table id and key as names, so two keys of one table that only differ in case share
+// a length.
+//==============================================================================================================
+UCLASS(BlueprintType)
+class SIMPLEDIALOGUE_API UDialogueLineDurations : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	//Letters of InText in the current language. False if the text isn't from a string table
+	//or the table hasn't been rebuilt since the line was added.
+	bool FindLetters(const FText &InText, float &OutLetters) const;
+
+	//Grapheme aware length of an already localized string
+	float CountLetters(const FString &InString, const FString &InCulture) const;
+
+	//Letters are stored in quarters
+	static constexpr float LetterScale = 4.0f;
+
+	//Reading weight of a CJK ideograph, kana or hangul syllable compared to one latin letter
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0), Category = "Reading Speed")
+	float WideGlyphLetters = 2.5f;
+
+	//Multiplier per culture or language, e.g. "de" 1.1 for longer German words. Full culture is tried first.
+	UPROPERTY(EditAnywhere, Category = "Reading Speed")
+	TMap<FString, float> CultureLetterScale;
+
+	//Every line in the durations, in the same order as the letters of each culture
+	UPROPERTY()
+	TArray<FDialogueLineDurationsKey> Lines;
+
+	//
+	UPROPERTY(VisibleAnywhere, Category = "Durations")
+	TArray<FDialogueCultureLineDurations> Cultures;
+
+	//Hash of the keys and source strings of every string table the lines came from
+	UPROPERTY(VisibleAnywhere, Category = "Durations")
+	TMap<FName, uint32> SourceTableHashes;
+
+#if WITH_EDITOR
+	//Called by the editor module before the asset is saved
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnRebuild, class UDialogueLineDurations *);
+	static FOnRebuild OnRebuild;
+
+	//Called by the editor module to rebuild if a source string table changed
+	static FOnRebuild OnVerify;
+
+	//Rebuilds in memory if a string table was edited since the asset was saved
+	void VerifySourceTables();
+
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif //
+
+private:
+
+	//Index in Cultures for the current language, INDEX_NONE if not found
+	int32 FindCulture() const;
+
+	//After Lines or Cultures changed
+	void ResetCaches();
+
+	//Culture lookup is redone only when the language changes
+	mutable FCulturePtr CachedLanguage;
+	mutable int32 CachedCulture = INDEX_NONE;
+
+	//Index in Lines, built on the first lookup
+	mutable TMap<TPair<FName, FName>, int32> LineIndices;
+};
@@ -0,0 +1,46 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//==============================================================================================================
+// Slices of one script line. All views point into the line that was tokenized.
+//==============================================================================================================
+struct FDialogueLineTokens
+{
+	//Name before ": ", empty if the line has no speaker
+	FStringView Speaker;
+
+	//Text without surrounding quotes and without the expression
+	FStringView Text;
+
+	//Content of the trailing "(...)", empty if none
+	FStringView Expression;
+};
+
+//==============================================================================================================
+// Single pass tokenizer for script lines, does not allocate.
+//
+//	Line		:= [Speaker ": "] Body
+//	Body		:= Text [" (" Expression ")"]
+//	Text		:= '"' Anything '"' | Anything
+//
+// Speaker separator only counts if it comes before the first quote, and the expression only counts if its
+// parenthesis are outside of quotes. Trailing spaces are ignored everywhere.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueLineTokenizer
+{
+public:
+
+	//
+	static void Tokenize(FStringView InLine, FDialogueLineTokens &OutTokens);
+
+	//
+	static FStringView TrimSpaces(FStringView InView);
+
+	//Removes one pair of surrounding quotes
+	static FStringView StripQuotes(FStringView InView);
+};
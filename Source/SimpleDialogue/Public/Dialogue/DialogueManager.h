@@ -7,6 +7,11 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "DialogueContext.h"
+#include "DialogueContextFeed.h"
+#include "DialogueStats.h"
+#include "DialogueTelemetry.h"
+#include "DialogueTextCache.h"
+#include "DialogueTextFormatter.h"
 #include "DialogueSystemEnums.h"
 #include "GameplayTagContainer.h"
 #include "DialogueManager.generated.h"
@@ -87,9 +92,25 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ActivateDialogue();
 
-	//
+	//Everything is updated
 	UFUNCTION(BlueprintCallable)
-	FORCEINLINE void QueueDialogueUpdate() { ShouldUpdateDialogue = true; }
+	FORCEINLINE void QueueDialogueUpdate() { MarkDialogueDirty(EDialogueDirty::All); }
+
+	//InFlags are sent with the next OnDialogueUpdated
+	FORCEINLINE void MarkDialogueDirty(EDialogueDirty InFlags) { DirtyFlags |= InFlags; }
+
+	//Broadcasts OnDialogueUpdated right away with InFlags only. Queued flags still wait for the tick
+	void BroadcastDialogueUpdate(EDialogueDirty InFlags);
+
+	//Calls InFunction as if from OnDialogueUpdated with InFlags, for a listener's own first update
+	void CallWithUpdateFlags(EDialogueDirty InFlags, TFunctionRef<void()> InFunction);
+
+	//What changed, only valid during OnDialogueUpdated
+	FORCEINLINE EDialogueDirty GetUpdateFlags() const { return UpdateFlags; }
+
+	//Did InFlag change, only valid during OnDialogueUpdated
+	UFUNCTION(BlueprintPure, Category = "Dialogue")
+	bool WasUpdated(EDialogueDirty InFlag) const;
 
 	//
 	UFUNCTION(BlueprintPure, Category = "Dialogue")
@@ -132,6 +153,28 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Dialogue")
 	FText GetText() const;
 
+	//Dialogue text as a string, resolved once per line and culture
+	const FString &GetDisplayString() const;
+
+	//Value of {InName} in dialogue lines, e.g. the key bound to an action or a character name
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	void SetTextArgument(const FString &InName, FText InValue);
+
+	//
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	void SetTextArgumentNumber(const FString &InName, int32 InValue);
+
+	//
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	void RemoveTextArgument(const FString &InName);
+
+	//Size of the dialogue text with InFont, measured once per line
+	UFUNCTION(BlueprintPure, Category = "Dialogue")
+	FVector2D GetTextSize(const FSlateFontInfo &InFont) const;
+
+	//Display strings of the active script's string table
+	FORCEINLINE FDialogueTextCache &GetTextCache() const { return TextCache; }
+
 	//
 	UFUNCTION(BlueprintPure, Category = "Dialogue")
 	class AActor *GetSpeaker() const;
@@ -148,6 +191,9 @@ public:
 	FORCEINLINE float GetAdditionalTextTime() const { return AdditionalTextTime; }
 	FORCEINLINE float GetMinimumTextTime() const { return MinimumTextTime; }
 
+	//Automatic duration of a line, from LineDurations when the line is in it
+	float GetTextDuration(const FText &InText) const;
+
 	//
 	class AActor *GetPlayerActor() const;
 
@@ -185,10 +231,13 @@ private:
 	EDialogueExpression PreviousExpression;
 
 	//Dialogue can change several times in one frame. Sometimes native events wont fire if they have already been fired that frame.
-	//Using Should Update Dialogue we make sure that the HUD gets updated to the most up to date data.
+	//Using Dirty Flags we make sure that the HUD gets updated to the most up to date data, and only the parts that changed.
 	//If dialogue is changed after the components ComponentTick the HUD will be updated next frame
 	UPROPERTY(Transient)
-	bool ShouldUpdateDialogue;
+	EDialogueDirty DirtyFlags = EDialogueDirty::None;
+
+	//Flags of the OnDialogueUpdated being broadcast
+	EDialogueDirty UpdateFlags = EDialogueDirty::None;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category = "Dialogue")
 	float							TimePerLetter = 0.05f;
@@ -199,6 +248,22 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category = "Dialogue")
 	float							MinimumTextTime = 1.0f;
 
+	//Line lengths precomputed per culture. Without it the length of the localized string is used.
+	UPROPERTY(EditDefaultsOnly, Category = "Dialogue")
+	TSoftObjectPtr<class UDialogueLineDurations> LineDurations;
+
+	UPROPERTY(Transient)
+	class UDialogueLineDurations	*LoadedLineDurations = NULL;
+
+	//Warmed when a dialogue activates
+	mutable FDialogueTextCache		TextCache;
+
+	//Arguments of GetText
+	mutable FDialogueTextFormatter	TextFormatter;
+
+	//Widgets show the text formatted with the old arguments until told otherwise
+	FORCEINLINE void OnTextArgumentsChanged() { if (InDialogue()) MarkDialogueDirty(EDialogueDirty::Text); }
+
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin=0), Category = "Dialogue")
 	int32 MaxChoices = 4;
 
@@ -234,6 +299,13 @@ public:
 	//
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FDialogueEvent, class AActor*, Speaker, FText, Text);
 
+	//Native versions of the events for C++ listeners, no reflection on broadcast. Remove with the returned handle
+	DECLARE_MULTICAST_DELEGATE_OneParam(FDialogueManagerNativeEvent, EDialogueDirty);
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FDialogueActorNativeEvent, class AActor *, class AActor *);
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FDialogueSpeakerNativeEvent, class AActor *, EDialogueExpression);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FDialogueAssetNativeEvent, class UDataAsset *);
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FDialogueNativeEvent, class AActor *, const FText &);
+
 	//
 	UPROPERTY(BlueprintAssignable)
 	FDialogueManagerEvent OnDialogueUpdated;
@@ -258,6 +330,15 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FDialogueEvent OnDialogue;
 
+	//Called before OnDialogueUpdated, with the flags of the update
+	FDialogueManagerNativeEvent OnDialogueUpdatedNative;
+
+	//Called before the dynamic event of the same name
+	FDialogueActorNativeEvent OnSpeakerChangedNative;
+	FDialogueSpeakerNativeEvent OnExpressionChangedNative;
+	FDialogueAssetNativeEvent OnDialogueAssetHoveredNative;
+	FDialogueNativeEvent OnDialogueNative;
+
 	//
 	UFUNCTION(BlueprintCallable)
 	void ClearAllEvents(class UObject *Object);
@@ -267,7 +348,7 @@ public:
 	//==============================================================================================================
 public:
 
-	//
+	//Sorted by name, children of UDialogueSettings::ContextRoots. Cached in FDialogueContextTagCatalogue
 	UFUNCTION(BlueprintCallable, meta=(CallableWithoutWorldContext=true))
 	static void GetAllContextTags(TArray<FGameplayTag> &OutTags);
 
@@ -314,6 +395,57 @@ public:
 	//
 	FORCEINLINE bool IsGlobalContext(const FGameplayTag &InActorTag) const { return !InActorTag.IsValid(); }
 
+	//
+	FORCEINLINE const FContextMapType &GetGlobalContext() const { return GlobalContext; }
+	FORCEINLINE const TMap<FGameplayTag, FSavedContextMap> &GetActorContext() const { return ActorContext; }
+
+	//Replaces all context without change events, for tools that run the same dialogue many times
+	void SaveContextSnapshot(FDialogueContextSnapshot &OutSnapshot) const;
+	void RestoreContextSnapshot(const FDialogueContextSnapshot &InSnapshot);
+
+#if SIMPLEDIALOGUE_CONTEXT_FEED
+	//Every context change, for debugging tools
+	FORCEINLINE const FDialogueContextFeed &GetContextFeed() const { return ContextFeed; }
+#endif //
+
+	//Context storage per actor tag, global context first, then largest first
+	void GetContextMemoryUsage(TArray<struct FDialogueContextMemoryUsage> &OutUsage) const;
+
+	//
+	virtual void GetResourceSizeEx(FResourceSizeEx &CumulativeResourceSize) override;
+
+	//Does nothing unless FDialogueTelemetry is recording
+	void RecordTelemetry(EDialogueTelemetryEvent InType, FName InKey = NAME_None, int32 InIndex = INDEX_NONE) const;
+
+private:
+
+	//Fills in the time and the current script
+	void SendTelemetry(FDialogueTelemetryRecord &InOutRecord) const;
+
+	//
+	void RecordContextChange(EDialogueContextChange InType, const FGameplayTag &InTag, const FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue);
+
+	//Context feed, trace and telemetry, only called when one of them can be listening
+	void NotifyContextObservers(EDialogueContextChange InType, const FGameplayTag &InTag, const FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue);
+	static FORCEINLINE bool HasContextObservers() { return SIMPLEDIALOGUE_CONTEXT_FEED || SIMPLEDIALOGUE_TRACE_ENABLED || FDialogueTelemetry::IsRecording(); }
+
+	//Context map memory for "stat SimpleDialogue" after one write. Only the map the write touched is measured,
+	//InOldSize is GetContextStatSize of the same map from before the write
+	void UpdateContextStats(const FContextMapType *InMap, SIZE_T InOldSize);
+	FORCEINLINE SIZE_T GetContextStatSize(const FContextMapType *InMap) const { return ActorContext.GetAllocatedSize() + (InMap ? InMap->GetAllocatedSize() : 0); }
+
+	//Measures every map again, after all context is replaced
+	void RecountContextStats();
+
+#if SIMPLEDIALOGUE_CONTEXT_FEED
+	FDialogueContextFeed ContextFeed;
+#endif //
+
+#if STATS
+	//What this manager has added to STAT_DialogueContextMemory
+	SIZE_T ContextStatSize = 0;
+#endif //
+
 private:
 
 	//
@@ -348,6 +480,12 @@ FORCEINLINE void UDialogueManager::ClearAllEvents(class UObject *Object)
 	OnExpressionChanged.RemoveAll(Object);
 	OnDialogueAssetHovered.RemoveAll(Object);
 	OnDialogue.RemoveAll(Object);
+
+	OnDialogueUpdatedNative.RemoveAll(Object);
+	OnSpeakerChangedNative.RemoveAll(Object);
+	OnExpressionChangedNative.RemoveAll(Object);
+	OnDialogueAssetHoveredNative.RemoveAll(Object);
+	OnDialogueNative.RemoveAll(Object);
 }
 
 //==============================================================================================================
@@ -370,6 +508,8 @@ FORCEINLINE bool UDialogueManager::HasContext(FGameplayTag InTag, FGameplayTag I
 	}
 #endif //
 
+	SCOPE_CYCLE_COUNTER(STAT_DialogueContextRead);
+
 	FContextMapType* pData = FindContextMap(InActorTag);
 	return pData && pData->Contains(InTag);
 
@@ -388,6 +528,8 @@ FORCEINLINE int32 UDialogueManager::GetContext(FGameplayTag InTag, FGameplayTag
 	}
 #endif //
 
+	SCOPE_CYCLE_COUNTER(STAT_DialogueContextRead);
+
 	FContextMapType *pData = FindContextMap(InActorTag);
 	const int32 *pValue = pData != NULL ? pData->Find(InTag) : NULL;
 	if (pValue)
@@ -459,4 +601,101 @@ FORCEINLINE bool UDialogueManager::SpeakDialogue(TSoftClassPtr<class UDialogue>
 {
 	SpeakDialogueLatent(NewDialogue, InPlayer, InActor, InSpeakContext, InWaitForActivation, FLatentActionInfo());
 	return InDialogue();
+}
+//=================================================================
+// 
+//=================================================================
+FORCEINLINE void UDialogueManager::RecordContextChange(EDialogueContextChange InType, const FGameplayTag &InTag, const FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue)
+{
+	//Clear has no tag, any line could have used one of the removed values
+	if (!InActorTag.IsValid())
+	{
+		if (InType == EDialogueContextChange::Clear)
+		{
+			TextFormatter.Invalidate();
+			OnTextArgumentsChanged();
+		}
+		else if (TextFormatter.OnContextChanged(InTag))
+		{
+			OnTextArgumentsChanged();
+		}
+	}
+
+	//Shipping builds without telemetry recording only pay for this check
+	if (HasContextObservers())
+	{
+		NotifyContextObservers(InType, InTag, InActorTag, InOldValue, InNewValue);
+	}
+}
+
+//=================================================================
+// 
+//=================================================================
+FORCEINLINE void UDialogueManager::SaveContextSnapshot(FDialogueContextSnapshot &OutSnapshot) const
+{
+	OutSnapshot.GlobalContext = GlobalContext;
+	OutSnapshot.ActorContext = ActorContext;
+}
+
+//=================================================================
+// 
+//=================================================================
+FORCEINLINE void UDialogueManager::RestoreContextSnapshot(const FDialogueContextSnapshot &InSnapshot)
+{
+	GlobalContext = InSnapshot.GlobalContext;
+	ActorContext = InSnapshot.ActorContext;
+
+	TextFormatter.Invalidate();
+	OnTextArgumentsChanged();
+
+#if SIMPLEDIALOGUE_CONTEXT_FEED
+	ContextFeed.Invalidate();
+#endif //
+
+	RecountContextStats();
+}
+
+//=================================================================
+// 
+//=================================================================
+FORCEINLINE void UDialogueManager::UpdateContextStats(const FContextMapType *InMap, SIZE_T InOldSize)
+{
+#if STATS
+	SIZE_T NewSize = GetContextStatSize(InMap);
+	if (NewSize >= InOldSize)
+	{
+		INC_MEMORY_STAT_BY(STAT_DialogueContextMemory, NewSize - InOldSize);
+	}
+	else
+	{
+		DEC_MEMORY_STAT_BY(STAT_DialogueContextMemory, InOldSize - NewSize);
+	}
+
+	ContextStatSize = ContextStatSize + NewSize - InOldSize;
+#endif //
+}
+
+//=================================================================
+// 
+//=================================================================
+FORCEINLINE void UDialogueManager::RecountContextStats()
+{
+#if STATS
+	SIZE_T Size = GlobalContext.GetAllocatedSize() + ActorContext.GetAllocatedSize();
+	for (auto It = ActorContext.CreateConstIterator(); It; ++It)
+	{
+		Size += It.Value().Values.GetAllocatedSize();
+	}
+
+	if (Size >= ContextStatSize)
+	{
+		INC_MEMORY_STAT_BY(STAT_DialogueContextMemory, Size - ContextStatSize);
+	}
+	else
+	{
+		DEC_MEMORY_STAT_BY(STAT_DialogueContextMemory, ContextStatSize - Size);
+	}
+
+	ContextStatSize = Size;
+#endif //
 }
\ No newline at end of file
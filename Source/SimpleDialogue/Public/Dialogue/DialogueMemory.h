@@ -0,0 +1,54 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+//==============================================================================================================
+// Bytes held by one UDialogue instance. Containers count their allocation, not the element count, so slack
+// left after ClearChoices shows up too. Text is the display strings the instance points at, which can be
+// shared with the string table.
+//==============================================================================================================
+struct FDialogueMemoryUsage
+{
+	//UObject and blueprint variables
+	SIZE_T Object = 0;
+
+	SIZE_T Choices = 0;
+	SIZE_T VisitedChoices = 0;
+	SIZE_T CustomSpeakers = 0;
+
+	//Current line and choice titles
+	SIZE_T Text = 0;
+
+	FORCEINLINE SIZE_T GetTotal() const { return Object + Choices + VisitedChoices + CustomSpeakers + Text; }
+};
+
+//==============================================================================================================
+// Shared by every instance of a script class
+//==============================================================================================================
+struct FDialogueClassMemoryUsage
+{
+	//Size of an instance, native and blueprint variables
+	SIZE_T Properties = 0;
+
+	//Blueprint VM code of the functions declared in the class
+	SIZE_T Bytecode = 0;
+	int32 NumFunctions = 0;
+
+	//
+	SIMPLEDIALOGUE_API static void Get(const class UClass *InClass, FDialogueClassMemoryUsage &OutUsage);
+};
+
+//==============================================================================================================
+// Context storage of one actor tag, empty tag for global context
+//==============================================================================================================
+struct FDialogueContextMemoryUsage
+{
+	FGameplayTag ActorTag;
+	int32 Num = 0;
+	SIZE_T Bytes = 0;
+};
@@ -0,0 +1,136 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FAutoConsoleVariableRef;
+
+//Line timing is only recorded in playtest builds
+#ifndef SIMPLEDIALOGUE_PACING
+#define SIMPLEDIALOGUE_PACING !UE_BUILD_SHIPPING
+#endif //
+
+//==============================================================================================================
+// How long lines were shown, about 250 bytes no matter how many lines are added.
+//
+// Lines the player advanced by hand, either skipped before Box_Delay ran out or lines without a delay, show how long
+// reading actually takes. Those go into the shown time buckets and into a least squares fit of shown time against
+// letter count, which gives TimePerLetter and AdditionalTextTime directly.
+//==============================================================================================================
+struct SIMPLEDIALOGUE_API FDialoguePacingHistogram
+{
+	//Shown time / Box_Delay in steps of 0.1, last bucket is everything from 1.5 up
+	static constexpr int32 NumRatioBuckets = 16;
+	static constexpr float RatioBucketSize = 0.1f;
+
+	//Seconds shown for lines advanced by hand in steps of 0.25, last bucket is everything from 7.75 up
+	static constexpr int32 NumShownBuckets = 32;
+	static constexpr float ShownBucketSize = 0.25f;
+
+	uint32 RatioBuckets[NumRatioBuckets] = {};
+	uint32 ShownBuckets[NumShownBuckets] = {};
+
+	uint32 NumLines = 0;
+
+	//Skipped while Box_Delay was still running
+	uint32 NumSkippedEarly = 0;
+
+	//Box_Delay of zero, shown until skipped
+	uint32 NumUntimed = 0;
+
+	double TotalShown = 0.0;
+	double TotalDelay = 0.0;
+
+	//Lines advanced by hand, for the fit
+	uint32 NumFit = 0;
+	double SumLetters = 0.0;
+	double SumShown = 0.0;
+	double SumLettersSquared = 0.0;
+	double SumLettersShown = 0.0;
+
+	//
+	void Add(float InShown, float InDelay, int32 InLetters, bool bInSkippedEarly);
+	void Merge(const FDialoguePacingHistogram &InOther);
+
+	//Returns false if there is not enough data or every line had the same length
+	bool FitTiming(float &OutTimePerLetter, float &OutAdditionalTextTime) const;
+
+	//Seconds below which InFraction of the lines advanced by hand were skipped
+	float GetShownPercentile(float InFraction) const;
+
+	//
+	friend FArchive &operator<<(FArchive &Ar, FDialoguePacingHistogram &Histogram);
+};
+
+//==============================================================================================================
+// Histograms per script and per string table key. Game thread only.
+//
+// Nothing is recorded until SimpleDialogue.Pacing.Record is set, and then only lines shown in game worlds.
+// Tools that play dialogue without a player hold an FScopedDisable so made up timing never gets into the report.
+//
+// Recording builds flush to Saved/SimpleDialogue/Pacing on SimpleDialogue.Pacing.Save and on shutdown, the editor
+// report merges every file in that folder. Flushed lines are cleared, so every line is in exactly one file or still
+// in memory.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialoguePacing
+{
+public:
+
+	//
+	static FDialoguePacing &Get();
+
+	//SimpleDialogue.Pacing.Record
+	static FORCEINLINE bool IsRecording() { return bRecording; }
+
+	//Recording is off while in scope, even if the console variable is set
+	struct FScopedDisable
+	{
+		FScopedDisable() : bWasRecording(bRecording) { bRecording = false; }
+		~FScopedDisable() { bRecording = bWasRecording; }
+
+	private:
+		bool bWasRecording;
+	};
+
+	//
+	void AddLine(FName InScript, FName InKey, float InShown, float InDelay, int32 InLetters, bool bInSkippedEarly);
+
+	//
+	FORCEINLINE const TMap<FName, FDialoguePacingHistogram> &GetScripts() const { return Scripts; }
+	FORCEINLINE const TMap<TPair<FName, FName>, FDialoguePacingHistogram> &GetKeys() const { return Keys; }
+	FORCEINLINE bool IsEmpty() const { return Scripts.Num() == 0; }
+
+	//
+	void Reset();
+	void Merge(const FDialoguePacing &InOther);
+
+	//
+	static FString GetDirectory();
+	bool Save(const FString &InFilename) const;
+	bool Load(const FString &InFilename);
+
+	//Saves and clears what was saved
+	bool Flush(const FString &InFilename);
+
+	//New file in GetDirectory
+	static FString MakeFilename();
+
+	//Merges every file in GetDirectory
+	int32 LoadDirectory();
+
+	static constexpr uint32 FileMagic = 0x50444453; //SDDP
+	static constexpr uint32 FileVersion = 1;
+
+private:
+
+	static bool bRecording;
+	static FAutoConsoleVariableRef RecordVariable;
+
+	TMap<FName, FDialoguePacingHistogram> Scripts;
+
+	//Script and key
+	TMap<TPair<FName, FName>, FDialoguePacingHistogram> Keys;
+};
@@ -0,0 +1,61 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+//==============================================================================================================
+// One gathered text pin of a dialogue blueprint
+//==============================================================================================================
+struct FDialogueScriptLine
+{
+	FText Text;
+
+	//Player, Target, Narrator or the custom speaker name. Empty for texts that are not dialogue lines
+	FString Speaker;
+	FString Expression;
+
+	//Empty if not from string table
+	FString TableId;
+	FString Key;
+
+	//Enough to find the pin again without searching the graphs
+	FGuid NodeGuid;
+	FGuid PinId;
+
+	friend FArchive &operator<<(FArchive &Ar, FDialogueScriptLine &Line);
+};
+
+//==============================================================================================================
+// Gathered texts of a dialogue blueprint stored in the derived data cache, keyed by the saved package hash from
+// the asset registry, so the package file is never read to make the key. Unchanged scripts load straight from the cache in later editor sessions and project-wide reports.
+// Packages with unsaved changes are always gathered live.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueScriptDerivedData
+{
+public:
+
+	//Lines in the same order as UDialogue::GatherAllTexts
+	static bool GetLines(class UBlueprint *InBlueprint, TArray<FDialogueScriptLine> &OutLines);
+
+	//Gathers without the cache
+	static void GatherLines(class UBlueprint *InBlueprint, TArray<FDialogueScriptLine> &OutLines);
+
+	//
+	static class UEdGraphPin *FindPin(class UBlueprint *InBlueprint, const FGuid &InNodeGuid, const FGuid &InPinId);
+
+	//Saved hash of the package from the asset registry, or the file time and size for packages saved without one.
+	//Empty if the package has no saved file
+	static FString GetSavedPackageKey(FName InPackageName);
+
+private:
+
+	//Empty if the package has no saved file or has unsaved changes
+	static FString GetCacheKey(class UBlueprint *InBlueprint);
+};
+
+#endif //WITH_EDITOR
@@ -0,0 +1,79 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+//==============================================================================================================
+// Receives the exported script one line at a time
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueScriptWriter
+{
+public:
+
+	virtual ~FDialogueScriptWriter() { }
+
+	//Depth is the choice / branch nesting level
+	virtual void WriteLine(int32 InDepth, FStringView InLine) = 0;
+};
+
+//==============================================================================================================
+// Writes UTF-8 lines with tab indentation into an archive
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueScriptArchiveWriter : public FDialogueScriptWriter
+{
+public:
+
+	FDialogueScriptArchiveWriter(FArchive &InArchive) : Archive(InArchive) { }
+
+	virtual void WriteLine(int32 InDepth, FStringView InLine) override;
+
+private:
+
+	FArchive &Archive;
+};
+
+//==============================================================================================================
+// Streams the script tree of a dialogue blueprint out through a writer, in execution order starting from every
+// event. Nothing is copied to the clipboard or to ClipboardTexts.
+//
+//	@# Event name
+//	Speaker: Text (Expression)
+//	@* Choice text
+//		Speaker: Text inside the choice
+//	@[Branch output]
+//		Speaker: Text inside the branch
+//	@-> Speaker: Text		Execution joins a line that was already written
+//
+// Only lines starting with StructurePrefix are structure. A spoken line that starts with StructurePrefix or
+// Escape is written with Escape in front, so any text a line can have comes back as the same text.
+//
+// The import (UDialogue::GenerateNodesInGraph) only makes a chain of DialogueBox nodes. It skips and logs the
+// structure lines, so an exported script comes back as its spoken lines in story order without the choices
+// and branches around them.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueScriptExporter
+{
+public:
+
+	//Returns number of lines written
+	static int32 Export(class UBlueprint *InBlueprint, FDialogueScriptWriter &Writer);
+
+	//
+	static bool ExportToFile(class UBlueprint *InBlueprint, const FString &InFilename);
+
+	static constexpr TCHAR StructurePrefix = TEXT('@');
+	static constexpr TCHAR Escape = TEXT('\\');
+
+	//Event, choice, branch or jump line written by Export, InLine without indentation
+	FORCEINLINE static bool IsStructureLine(FStringView InLine) { return InLine.Len() > 0 && InLine[0] == StructurePrefix; }
+
+	//Spoken line with Escape removed, InLine without indentation
+	static FStringView UnescapeLine(FStringView InLine);
+};
+
+#endif //WITH_EDITOR
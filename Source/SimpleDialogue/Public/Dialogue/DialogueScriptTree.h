@@ -0,0 +1,120 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+#include "EdGraph/EdGraphPin.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+enum class EDialogueScriptItemType : uint8
+{
+	//Event the conversation starts from, Label is the event name
+	Entry,
+
+	//DialogueBox
+	Line,
+
+	//DialogueChoices, children are what runs after the choice is selected
+	Choice,
+
+	//One output of a branching node, Label is the pin name
+	Branch,
+
+	//Execution continues at a position that was already walked, either a join or a loop
+	Jump,
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct FDialogueScriptItem
+{
+	EDialogueScriptItemType Type = EDialogueScriptItemType::Line;
+
+	FText Text;
+	FString Speaker;
+	FString Expression;
+	FString Label;
+
+	FEdGraphPinReference TextPin;
+
+	//Index into FDialogueScriptTree items
+	TArray<int32> Children;
+
+	//For Jump, children index JumpChild of item JumpParent. JumpChild can be one past the last child
+	int32 JumpParent = INDEX_NONE;
+	int32 JumpChild = INDEX_NONE;
+};
+
+//==============================================================================================================
+// Script of a dialogue blueprint in story order. Built by following exec pins from every event through
+// DialogueBox and DialogueChoices outputs. Every graph node is walked only once, when another path reaches
+// it again the walk stores a Jump to the first place it was written instead of walking the shared part again.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueScriptTree
+{
+public:
+
+	//
+	static void Build(class UBlueprint *InBlueprint, FDialogueScriptTree &OutTree);
+
+	//
+	FORCEINLINE const TArray<FDialogueScriptItem> &GetItems() const { return Items; }
+	FORCEINLINE const TArray<int32> &GetRoots() const { return Roots; }
+	FORCEINLINE int32 GetNumLines() const { return NumLines; }
+
+	//Pre-order walk, Func(const FDialogueScriptItem &Item, int32 Depth). Roots are depth 0
+	template<typename FunctorType>
+	void Visit(FunctorType &&Func) const;
+
+	//"Speaker: Text (Expression)" for lines, "* Text" for choices
+	static FString GetItemString(const FDialogueScriptItem &InItem);
+
+	//Item a jump goes to, NULL if it points past the end of a path
+	const FDialogueScriptItem *GetJumpTarget(const FDialogueScriptItem &InItem) const;
+
+	//
+	static bool IsDialogueBoxNode(const class UEdGraphNode *InNode);
+	static bool IsDialogueChoiceNode(const class UEdGraphNode *InNode);
+
+private:
+
+	TArray<FDialogueScriptItem> Items;
+	TArray<int32> Roots;
+	int32 NumLines = 0;
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+template<typename FunctorType>
+void FDialogueScriptTree::Visit(FunctorType &&Func) const
+{
+	TArray<TPair<int32, int32>, TInlineAllocator<64>> Stack;
+	for (int32 i=Roots.Num() - 1; i>=0; i--)
+	{
+		Stack.Add(TPair<int32, int32>(Roots.GetData()[i], 0));
+	}
+
+	while (Stack.Num() > 0)
+	{
+		TPair<int32, int32> Current = Stack.Pop();
+		const FDialogueScriptItem &Item = Items.GetData()[Current.Key];
+
+		Func(Item, Current.Value);
+
+		for (int32 i=Item.Children.Num() - 1; i>=0; i--)
+		{
+			Stack.Add(TPair<int32, int32>(Item.Children.GetData()[i], Current.Value + 1));
+		}
+	}
+}
+
+#endif //WITH_EDITOR
@@ -0,0 +1,30 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "DialogueSettings.generated.h"
+
+//==============================================================================================================
+// Project settings, Project Settings -> Plugins -> Simple Dialogue
+//==============================================================================================================
+UCLASS(config=Game, defaultconfig, meta=(DisplayName="Simple Dialogue"))
+class SIMPLEDIALOGUE_API UDialogueSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UDialogueSettings();
+
+	//Gameplay tags whose children are context tags
+	UPROPERTY(config, EditAnywhere, Category = "Context")
+	TArray<FName> ContextRoots;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif //
+};
@@ -0,0 +1,130 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Dialogue/DialogueContext.h"
+
+//==============================================================================================================
+//
+//==============================================================================================================
+enum class EDialogueSimulationMode : uint8
+{
+	//Every combination of choices, until MaxRuns
+	DepthFirst,
+
+	//MaxRuns walks with random choices
+	RandomWalk,
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct FDialogueSimulationSettings
+{
+	EDialogueSimulationMode Mode = EDialogueSimulationMode::DepthFirst;
+
+	//
+	int32 MaxRuns = 1000;
+
+	//Lines and choices in one run before it is counted as a loop
+	int32 MaxSteps = 500;
+
+	//Used for choices in random walks and for FMath::Rand, so MakeRandomRoll gives the same results every run
+	int32 RandomSeed = 0;
+
+	//
+	FGameplayTag SpeakContext;
+
+	//Context in the manager before every run
+	FDialogueContextSnapshot Context;
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct FDialogueSimulationReport
+{
+	FString Script;
+
+	int32 NumRuns = 0;
+
+	//The dialogue deactivated itself
+	int32 NumCompleted = 0;
+
+	//Choices where none could be selected, or the dialogue waited on something that never finished
+	int32 NumDeadEnds = 0;
+
+	//Ran out of MaxSteps
+	int32 NumTruncated = 0;
+
+	//DepthFirst only, every combination was played
+	bool bExhausted = false;
+
+	//Lines per completed run
+	double AveragePathLength = 0.0;
+	int32 LongestPath = 0;
+
+	//Line texts that were shown at least once
+	TSet<FString> ReachedLines;
+	TSet<FString> ReachedChoices;
+
+	//Every line text in the script graphs, editor only. Lines in here and not in ReachedLines are unreachable
+	//with the given context and settings
+	TSet<FString> ScriptLines;
+
+	//Choices taken to get to each dead end, "1:Ask about the ship > 0:Leave"
+	TArray<FString> DeadEnds;
+
+	//
+	SIMPLEDIALOGUE_API FString ToString() const;
+};
+
+//==============================================================================================================
+// Plays a dialogue script without a game. Makes an empty world with stub player and target actors and a standalone
+// UDialogueManager, then drives Activate, Skip and SelectOption directly.
+//
+// Blueprint state can't be copied, so every path is played from the start with the context restored from the
+// snapshot. Depth first explores by changing the last choice that still has options left.
+//
+// Game thread only, the blueprint VM is not thread safe.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueSimulator
+{
+public:
+
+	FDialogueSimulator(TSubclassOf<class UDialogue> InClass, const FDialogueSimulationSettings &InSettings);
+	~FDialogueSimulator();
+
+	//
+	bool Run(FDialogueSimulationReport &OutReport);
+
+private:
+
+	enum class ERunResult : uint8
+	{
+		Completed,
+		DeadEnd,
+		Truncated,
+	};
+
+	//
+	bool CreateWorld();
+	void DestroyWorld();
+
+	//Follows InPath, then picks the first or a random selectable choice. Paths are positions in the list of
+	//selectable choices
+	ERunResult PlayOnce(const TArray<int32> &InPath, TArray<int32> &OutPath, TArray<int32> &OutNumOptions, FString &OutChoiceLog, int32 &OutNumLines, FDialogueSimulationReport &OutReport);
+
+	TSubclassOf<class UDialogue> DialogueClass;
+	FDialogueSimulationSettings Settings;
+	FRandomStream Random;
+
+	class UWorld *World = NULL;
+	class AActor *Player = NULL;
+	class AActor *Target = NULL;
+	class UDialogueManager *Manager = NULL;
+};
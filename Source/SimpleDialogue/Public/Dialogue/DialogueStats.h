@@ -0,0 +1,45 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Dialogue/DialogueTrace.h"
+
+//"stat SimpleDialogue"
+DECLARE_STATS_GROUP(TEXT("SimpleDialogue"), STATGROUP_SimpleDialogue, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Manager Tick"), STAT_DialogueManagerTick, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Context Read"), STAT_DialogueContextRead, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Context Write"), STAT_DialogueContextWrite, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Delegate Broadcast"), STAT_DialogueBroadcast, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Context Maps"), STAT_DialogueContextMemory, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Choices"), STAT_DialogueChoicesMemory, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Dialogue Objects"), STAT_DialogueObjectMemory, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Dialogues"), STAT_DialogueActive, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Barks"), STAT_DialogueActiveBarks, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Lines Per Second"), STAT_DialogueLinesPerSecond, STATGROUP_SimpleDialogue, SIMPLEDIALOGUE_API);
+
+//Delegate fan-out shows up both in "stat SimpleDialogue" and as its own scope in Insights
+#define SIMPLEDIALOGUE_BROADCAST_SCOPE(Delegate) SCOPE_CYCLE_COUNTER(STAT_DialogueBroadcast); SIMPLEDIALOGUE_TRACE_SCOPE(Delegate)
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct SIMPLEDIALOGUE_API FDialogueStats
+{
+	//Counts a shown line for Lines Per Second
+	static void AddLine();
+
+	//Publishes Lines Per Second once a second has passed
+	static void Update();
+
+private:
+
+	static double WindowStart;
+	static int32 WindowLines;
+};
@@ -60,4 +60,26 @@ enum class EDialogueArray : uint8
 	Start,
 	Victory,
 	Failure,
-};
\ No newline at end of file
+};
+
+//===============================================================================================================================
+// What changed since the last OnDialogueUpdated, see UDialogueManager::GetUpdateFlags
+//===============================================================================================================================
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EDialogueDirty : uint8
+{
+	None					= 0 UMETA(Hidden),
+	Text					= 1 << 0,
+	Speaker					= 1 << 1,
+	Expression				= 1 << 2,
+	Choices					= 1 << 3,
+	Hovered					= 1 << 4,
+	Page					= 1 << 5,
+	Pause					= 1 << 6,
+
+	//Line with a new duration or the duration ended. Progress itself is not sent, read GetTimeFraction when ticking
+	Time					= 1 << 7,
+
+	All						= 0xFF UMETA(Hidden),
+};
+ENUM_CLASS_FLAGS(EDialogueDirty);
\ No newline at end of file
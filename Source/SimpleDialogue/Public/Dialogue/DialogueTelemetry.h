@@ -0,0 +1,215 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "HAL/Runnable.h"
+#include "HAL/Event.h"
+#include <atomic>
+
+//==============================================================================================================
+//
+//==============================================================================================================
+enum class EDialogueTelemetryEvent : uint8
+{
+	//Key is the string table key of the line
+	Line,
+
+	//Key is the choice name, Index its position
+	ChoiceOffered,
+	ChoicePicked,
+
+	//Index is 1 when the whole dialogue was skipped
+	Skip,
+
+	//Tag, ActorTag, OldValue and NewValue, Index is EDialogueContextChange
+	ContextChange,
+};
+
+//==============================================================================================================
+// Plain values only, records are copied between threads
+//==============================================================================================================
+struct FDialogueTelemetryRecord
+{
+	//FDateTime ticks, UTC
+	int64 Time = 0;
+
+	EDialogueTelemetryEvent Type = EDialogueTelemetryEvent::Line;
+
+	//Dialogue class
+	FName Script;
+
+	FName Key;
+	int32 Index = INDEX_NONE;
+
+	FGameplayTag Tag;
+	FGameplayTag ActorTag;
+	int32 OldValue = 0;
+	int32 NewValue = 0;
+};
+
+//==============================================================================================================
+// Where the flush thread sends records. Called on the flush thread only, one batch at a time
+//==============================================================================================================
+class IDialogueTelemetrySink
+{
+public:
+
+	virtual ~IDialogueTelemetrySink() { }
+
+	//
+	virtual void Write(const TArray<FDialogueTelemetryRecord> &InRecords) = 0;
+
+	//Recording stopped, nothing more will be written
+	virtual void Close() { }
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+enum class EDialogueTelemetryFormat : uint8
+{
+	//One JSON object per line
+	NDJSON,
+
+	//Zlib compressed batches, see FDialogueTelemetryFileSink::WriteBinary
+	Binary,
+};
+
+//==============================================================================================================
+// Appends to one file per recording under Saved/SimpleDialogue/Telemetry
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTelemetryFileSink : public IDialogueTelemetrySink
+{
+public:
+
+	FDialogueTelemetryFileSink(const FString &InFilename, EDialogueTelemetryFormat InFormat);
+	virtual ~FDialogueTelemetryFileSink();
+
+	//
+	static FString MakeFilename(EDialogueTelemetryFormat InFormat);
+
+	//
+	virtual void Write(const TArray<FDialogueTelemetryRecord> &InRecords) override;
+	virtual void Close() override;
+
+	static constexpr uint32 BinaryMagic = 0x4C444453; //SDDL
+	static constexpr uint32 BinaryVersion = 1;
+
+private:
+
+	//
+	void WriteJson(const TArray<FDialogueTelemetryRecord> &InRecords);
+
+	//Per batch: magic, version, record count, uncompressed and compressed size, then the compressed records
+	void WriteBinary(const TArray<FDialogueTelemetryRecord> &InRecords);
+
+	class IFileHandle *File = NULL;
+	EDialogueTelemetryFormat Format;
+
+	//Scratch, reused between batches
+	FString Json;
+	TArray<uint8> Uncompressed;
+	TArray<uint8> Compressed;
+};
+
+//==============================================================================================================
+// Keeps everything in memory, stand-in for the file sink in tests and tools
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTelemetryMemorySink : public IDialogueTelemetrySink
+{
+public:
+
+	//
+	virtual void Write(const TArray<FDialogueTelemetryRecord> &InRecords) override;
+
+	//Copy of everything written so far, safe from any thread
+	void GetRecords(TArray<FDialogueTelemetryRecord> &OutRecords) const;
+
+private:
+
+	mutable FCriticalSection Lock;
+	TArray<FDialogueTelemetryRecord> Records;
+};
+
+//==============================================================================================================
+// Dialogue analytics. The game thread records into a fixed size single producer ring buffer without locks and a
+// background thread flushes it to the sink every FlushInterval seconds, or sooner when the buffer is half full.
+// When the flush thread falls behind records are dropped and counted, the game thread never waits.
+//
+// Fed by UDialogueManager, see UDialogueManager::RecordTelemetry.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTelemetry : public FRunnable
+{
+public:
+
+	static constexpr int32 Capacity = 8192;
+	static constexpr float FlushInterval = 1.0f;
+
+	//
+	static FDialogueTelemetry &Get();
+
+	//Game thread
+	static FORCEINLINE bool IsRecording() { return bRecording; }
+
+	//Stops a running recording first
+	void StartRecording(TUniquePtr<IDialogueTelemetrySink> InSink);
+
+	//Flushes what is left and closes the sink
+	void StopRecording();
+
+	//Game thread
+	void Record(const FDialogueTelemetryRecord &InRecord);
+
+	//
+	FORCEINLINE uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	//FRunnable
+	virtual uint32 Run() override;
+
+private:
+
+	//Flush thread
+	void Drain();
+
+	static bool bRecording;
+
+	TArray<FDialogueTelemetryRecord> Buffer;
+	std::atomic<uint64> WriteIndex { 0 };
+	std::atomic<uint64> ReadIndex { 0 };
+	std::atomic<uint64> NumDropped { 0 };
+	std::atomic<bool> bStopping { false };
+
+	class FEvent *WakeEvent = NULL;
+	class FRunnableThread *Thread = NULL;
+
+	TUniquePtr<IDialogueTelemetrySink> Sink;
+
+	//Flush thread scratch
+	TArray<FDialogueTelemetryRecord> Batch;
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FORCEINLINE void FDialogueTelemetry::Record(const FDialogueTelemetryRecord &InRecord)
+{
+	const uint64 iWrite = WriteIndex.load(std::memory_order_relaxed);
+	const uint64 iPending = iWrite - ReadIndex.load(std::memory_order_acquire);
+	if (iPending >= Capacity)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	Buffer.GetData()[iWrite & (Capacity - 1)] = InRecord;
+	WriteIndex.store(iWrite + 1, std::memory_order_release);
+
+	if (iPending + 1 == Capacity / 2)
+	{
+		WakeEvent->Trigger();
+	}
+}
@@ -0,0 +1,75 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+
+//==============================================================================================================
+// Display strings of one string table in the current culture, resolved in one go when a dialogue activates
+// instead of once per line and per widget read. The last looked up FText is remembered by identity, so reading
+// the current line again costs one pointer compare.
+//
+// Checks the text revision of FTextLocalizationManager on every lookup and resolves the table again after a
+// culture change or a localization hot reload. Game thread only.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTextCache
+{
+public:
+
+	//Resolves every line of the table. Nothing is done if the table and culture are the same as last time
+	void Warm(FName InTableId);
+
+	//
+	void Reset();
+
+	//Texts that are not in the warmed table are resolved on their own and remembered until the next text
+	const FString &GetDisplayString(const FText &InText);
+
+	//Size of the display string with InFont. Cached per line for the last font used
+	FVector2D GetSize(const FText &InText, const FSlateFontInfo &InFont);
+
+	//
+	FORCEINLINE FName GetTableId() const { return TableId; }
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+
+	struct FEntry
+	{
+		FString Display;
+		FVector2D Size = FVector2D::ZeroVector;
+		bool bMeasured = false;
+	};
+
+	//Index in Entries, INDEX_NONE if the text is not in the table
+	int32 Find(const FText &InText);
+
+	//Clears everything resolved if the culture changed since
+	void CheckRevision();
+
+	//
+	void Resolve();
+
+	FName TableId;
+
+	//TableId was resolved, even if the table was missing or empty
+	bool bResolved = false;
+
+	TMap<FString, int32> KeyToEntry;
+	TArray<FEntry> Entries;
+
+	//FTextLocalizationManager::GetTextRevision when resolved
+	uint16 Revision = 0;
+
+	//Last lookup
+	FText LastText;
+	int32 LastEntry = INDEX_NONE;
+	FEntry LastOther;
+
+	//Sizes in Entries are for this font
+	FSlateFontInfo MeasureFont;
+};
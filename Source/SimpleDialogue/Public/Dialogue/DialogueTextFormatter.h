@@ -0,0 +1,103 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+//==============================================================================================================
+// Formats dialogue lines with arguments like {Attack} or {Use} without formatting on every widget read.
+//
+// Each line is parsed into an FTextFormat once per culture and keeps its formatted result until the value of
+// one of its own arguments changes. Arguments come from SetArgument, usually input bindings and character names
+// set by the game, or from global context when the argument name is a context tag, e.g. {Context.Quest.Gold}.
+//
+// Only lines with an argument that has a value are formatted. Lines without braces, and lines whose braces
+// don't name a set argument or context, are returned as they are, so backticks and braces in plain lines are
+// shown as written. Game thread only.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTextFormatter
+{
+public:
+
+	//Global context value of a tag, false if there is none
+	typedef TFunction<bool(const FGameplayTag &, int32 &)> FContextResolver;
+
+	//
+	FORCEINLINE void SetContextResolver(FContextResolver &&InResolver) { ContextResolver = MoveTemp(InResolver); }
+
+	//Formatted lines using InName are formatted again next time they are read. Returns false if the value was the same
+	bool SetArgument(const FString &InName, const FFormatArgumentValue &InValue);
+	bool RemoveArgument(const FString &InName);
+
+	//Global context InTag changed. Returns false if no parsed line uses it
+	bool OnContextChanged(const FGameplayTag &InTag);
+
+	//Every formatted line is formatted again next time, the parsed patterns are kept
+	void Invalidate();
+
+	//
+	void Reset();
+
+	//Returns InText itself if none of its arguments has a value
+	FText Format(const FText &InText);
+
+	//
+	SIZE_T GetAllocatedSize() const;
+
+	//Cleared when there are more parsed lines than this
+	static constexpr int32 MaxPatterns = 256;
+
+private:
+
+	struct FPattern
+	{
+		FTextFormat Format;
+		TArray<FString> ArgumentNames;
+
+		//Argument names that are context tags
+		TArray<FGameplayTag> ContextTags;
+
+		FText Formatted;
+
+		//Serial when Formatted was last made or checked, 0 if never
+		uint32 Serial = 0;
+	};
+
+	//
+	void CheckRevision();
+
+	//Any argument of the pattern changed after it was formatted
+	bool HasChangedSince(const FPattern &InPattern) const;
+
+	//
+	FPattern &FindOrAddPattern(const FText &InText);
+
+	FContextResolver ContextResolver;
+
+	FFormatNamedArguments Arguments;
+
+	//Context tags used by any parsed line, other context changes are ignored
+	TSet<FGameplayTag> UsedContextTags;
+
+	//Keyed by display string, the pattern is different in every culture
+	TMap<FString, FPattern> Patterns;
+
+	//Bumped whenever an argument changes
+	uint32 Serial = 1;
+
+	//Serial of the last change of each argument and used context tag, and of the last Invalidate
+	TMap<FString, uint32> ArgumentSerials;
+	TMap<FGameplayTag, uint32> ContextSerials;
+	uint32 InvalidateSerial = 0;
+
+	//FTextLocalizationManager::GetTextRevision of the parsed patterns
+	uint16 Revision = 0;
+
+	//Last line read, by identity
+	FText LastText;
+	FText LastFormatted;
+	uint32 LastSerial = 0;
+};
@@ -0,0 +1,94 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Dialogue/DialogueScriptTree.h"
+
+//==============================================================================================================
+// Per blueprint index from text identity (string table id + key, or source string) to the text pin using it.
+// Built once on first use and thrown away when any of the blueprint graphs change, when a node in it is modified
+// (pin default edits only modify the node) or when a string table is modified. A text that is not in the index is
+// a miss and does not rebuild anything. Pins are in story order, the script tree built for that is kept as well.
+//==============================================================================================================
+class SIMPLEDIALOGUE_API FDialogueTextPinIndex
+{
+public:
+
+	//
+	static FDialogueTextPinIndex &Get();
+
+	FDialogueTextPinIndex();
+
+	//
+	class UEdGraphPin *FindPin(class UBlueprint *InBlueprint, const FText &InText);
+
+	//Texts of every unlinked text input pin in the blueprint. Pins reached from events come first in execution order
+	const TArray<FText> &GetTexts(class UBlueprint *InBlueprint);
+
+	//Pins in the same order as GetTexts
+	const TArray<FEdGraphPinReference> &GetPins(class UBlueprint *InBlueprint);
+
+	//Cached until the blueprint changes
+	TSharedRef<const FDialogueScriptTree> GetScriptTree(class UBlueprint *InBlueprint);
+
+	//
+	void Invalidate(class UBlueprint *InBlueprint);
+
+	//
+	void InvalidateAll();
+
+	//
+	static FString GetTextIdentity(const FText &InText);
+
+	//Every unlinked text input pin in the graphs
+	static void GatherTextPinsFromGraph(const TArray<class UEdGraph*> &Graphs, TArray<class UEdGraphPin*> &OutPins);
+	static void GatherTextPins(class UBlueprint *InBlueprint, TArray<class UEdGraphPin*> &OutPins);
+
+private:
+
+	//
+	struct FEntry
+	{
+		TArray<FText> Texts;
+		TArray<FEdGraphPinReference> Pins;
+		TSharedPtr<FDialogueScriptTree> Tree;
+
+		//Index into Pins
+		TMap<FString, int32> IdentityToPin;
+		TMap<FString, int32> DisplayStringToPin;
+
+		TArray<TPair<TWeakObjectPtr<class UEdGraph>, FDelegateHandle>> GraphHandles;
+		FDelegateHandle ChangedHandle;
+		FDelegateHandle CompiledHandle;
+
+		bool bIsDirty = true;
+	};
+
+	//
+	FEntry &FindOrBuild(class UBlueprint *InBlueprint);
+	void Build(class UBlueprint *InBlueprint, FEntry &Entry);
+	void Unbind(class UBlueprint *InBlueprint, FEntry &Entry);
+
+	//Drops entries of blueprints that were garbage collected
+	void RemoveStaleEntries();
+
+	//
+	void OnGraphChanged(const struct FEdGraphEditAction &InAction, TWeakObjectPtr<class UBlueprint> InBlueprint);
+	void OnBlueprintChanged(class UBlueprint *InBlueprint);
+	void OnObjectModified(class UObject *InObject);
+
+	//
+	class UEdGraphPin *ResolveAndValidate(FEntry &Entry, int32 Index, const FText &InText, bool bIdentity) const;
+
+	TMap<TWeakObjectPtr<class UBlueprint>, FEntry> Entries;
+};
+
+#endif //WITH_EDITOR
@@ -0,0 +1,44 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Config.h"
+
+//Scopes and events on the SimpleDialogue trace channel, enable with -trace=cpu,SimpleDialogue
+#ifndef SIMPLEDIALOGUE_TRACE_ENABLED
+#define SIMPLEDIALOGUE_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif //
+
+#if SIMPLEDIALOGUE_TRACE_ENABLED
+
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+UE_TRACE_CHANNEL_EXTERN(SimpleDialogueChannel, SIMPLEDIALOGUE_API)
+
+//==============================================================================================================
+// Trace events with the class and tag names of what the dialogue system was doing, so hitches in a capture can
+// be tied to a script. Only call through SIMPLEDIALOGUE_TRACE, it skips the names when the channel is off.
+//==============================================================================================================
+struct SIMPLEDIALOGUE_API FDialogueTrace
+{
+	static void OutputSpeak(const class UClass *InClass, const struct FGameplayTag &InSpeakContext, bool bInWaitForActivation);
+	static void OutputLine(const class UDialogue *InDialogue, uint8 InSpeaker, const struct FGameplayTag &InVoiceOver, const struct FGameplayTag &InCustomName, float InDuration);
+	static void OutputChoice(const class UDialogue *InDialogue, FName InFunction, int32 InLink, int32 InNumChoices);
+	static void OutputSelect(const class UDialogue *InDialogue, int32 InIndex, FName InFunction);
+	static void OutputExecute(const class UDialogue *InDialogue, FName InFunction, int32 InLink);
+	static void OutputContextChange(uint8 InType, const struct FGameplayTag &InTag, const struct FGameplayTag &InActorTag, int32 InOldValue, int32 InNewValue);
+};
+
+#define SIMPLEDIALOGUE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("SimpleDialogue." #Name, SimpleDialogueChannel)
+#define SIMPLEDIALOGUE_TRACE(Event, ...) do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(SimpleDialogueChannel)) { FDialogueTrace::Output##Event(__VA_ARGS__); } } while (0)
+
+#else
+
+#define SIMPLEDIALOGUE_TRACE_SCOPE(Name)
+#define SIMPLEDIALOGUE_TRACE(Event, ...) do { } while (0)
+
+#endif //SIMPLEDIALOGUE_TRACE_ENABLED
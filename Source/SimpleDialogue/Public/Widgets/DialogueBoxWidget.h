@@ -0,0 +1,68 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/DialogueWidget.h"
+#include "DialogueBoxWidget.generated.h"
+
+//==============================================================================================================
+// Dialogue widget that updates one part at a time. Instead of OnUpdate rebuilding everything, each changed part
+// gets its own event, so moving the hovered choice only restyles the choices and doesn't touch the text, speaker
+// or choice list. OnUpdate is still called after the parts for anything else.
+//
+// DialogueText and TimeBar are filled natively when the widget blueprint has them.
+//==============================================================================================================
+UCLASS(Abstract, Blueprintable)
+class SIMPLEDIALOGUE_API UDialogueBoxWidget : public UDialogueWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	//
+	virtual void NativeOnDialogueUpdated(EDialogueDirty InFlags) override;
+
+	//
+	virtual void NativeTick(const FGeometry &MyGeometry, float InDeltaTime) override;
+
+	//Text of the line changed or the line ended
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnTextChanged(const FText &InText);
+
+	//
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnSpeakerChanged(class AActor *InSpeaker);
+
+	//
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnExpressionChanged(class AActor *InSpeaker, EDialogueExpression InExpression);
+
+	//Choices were added or removed, or paged. Rebuild the choice list
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnChoicesChanged();
+
+	//Only the hovered choice moved, the list is the same
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnHoveredChoiceChanged(int32 InHoveredChoice);
+
+	//
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnPauseChanged(bool bInPaused);
+
+	//A new line started its duration or the duration ended
+	UFUNCTION(BlueprintImplementableEvent, Category = "Dialogue")
+	void OnTimeChanged(bool bInHasDuration);
+
+protected:
+
+	//Text of the current line
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional), Category = "Dialogue")
+	class UTextBlock *DialogueText = NULL;
+
+	//Remaining time of the current line, hidden for lines without a duration
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional), Category = "Dialogue")
+	class UProgressBar *TimeBar = NULL;
+};
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Dialogue/DialogueSystemEnums.h"
 #include "DialogueWidget.generated.h"
 
 //==============================================================================================================
@@ -35,11 +36,17 @@ public:
 	void OnUpdate();
 	virtual void OnUpdate_Implementation() { }
 
+	//Only InFlags changed since the last update. Calls OnUpdate, native widgets can rebuild just the parts that changed
+	virtual void NativeOnDialogueUpdated(EDialogueDirty InFlags);
+
 	//
 	FORCEINLINE class UDialogueManager *GetManager() const { return Manager.Get(); }
 
 private:
 
+	//UDialogueManager::OnDialogueUpdatedNative
+	FDelegateHandle UpdatedHandle;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta=(AllowPrivateAccess=true), Category="Runtime")
 	TWeakObjectPtr<class UDialogueManager> Manager;
 };
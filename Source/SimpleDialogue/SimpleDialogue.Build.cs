@@ -34,7 +34,7 @@ public class SimpleDialogue : ModuleRules
 		if (Target.Type == TargetType.Editor)
         { 
             //Only need this when we generate wall meshes
-            PrivateDependencyModuleNames.AddRange(new string[] { "UnrealEd", "ApplicationCore", });
+            PrivateDependencyModuleNames.AddRange(new string[] { "UnrealEd", "ApplicationCore", "BlueprintGraph", "DerivedDataCache", "AssetRegistry", });
         }
 		
 		PrivateDependencyModuleNames.AddRange(
@@ -46,6 +46,7 @@ public class SimpleDialogue : ModuleRules
 				"SlateCore",
 				"UMG",
 				"GameplayTags",
+				"DeveloperSettings",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
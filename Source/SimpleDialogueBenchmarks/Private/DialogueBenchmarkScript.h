@@ -0,0 +1,40 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dialogue/Dialogue.h"
+#include "DialogueBenchmarkScript.generated.h"
+
+//==============================================================================================================
+// Native stand in for a dialogue blueprint. Lines continue through Step with ProcessEvent, the same way a
+// blueprint resumes its ubergraph, so Skip and SelectOption cost what they cost in a real script.
+//
+// Lives in the benchmark module so that it is never part of a shipping build.
+//==============================================================================================================
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class UDialogueBenchmarkScript : public UDialogue
+{
+	GENERATED_BODY()
+
+public:
+
+	//Lines shown before the script ends, set before the dialogue is spoken
+	static int32 NumLines;
+
+	//
+	virtual void OnActivate_Implementation() override;
+
+	//Latent info that resumes in Step
+	FLatentActionInfo MakeLatentInfo(int32 InLinkage);
+
+	//
+	UFUNCTION()
+	void Step(int32 EntryPoint);
+
+private:
+
+	int32 Line = 0;
+};
@@ -0,0 +1,88 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Dialogue/DialogueLineTokenizer.h"
+#include "Dialogue/Dialogue.h"
+
+//==============================================================================================================
+// Synthetic script lines covering every form the tokenizer handles
+//==============================================================================================================
+static void MakeScriptCorpus(int32 InNumLines, TArray<FString> &OutLines)
+{
+	static const TCHAR *Speakers[] = { TEXT("Player"), TEXT("Target"), TEXT("Narrator"), TEXT("Abigail"), TEXT("") };
+	static const TCHAR *Expressions[] = { TEXT(""), TEXT(" (Happy)"), TEXT(" (Angry)"), TEXT(" (Worried)") };
+
+	OutLines.Reset(InNumLines);
+	for (int32 i=0; i<InNumLines; i++)
+	{
+		const TCHAR *Speaker = Speakers[i % UE_ARRAY_COUNT(Speakers)];
+		const TCHAR *Expression = Expressions[(i / 3) % UE_ARRAY_COUNT(Expressions)];
+
+		FString Text = FString::Printf(TEXT("This is line number %d of the script, it is about as long as a normal line"), i);
+		if (i % 7 == 0)
+		{
+			Text = FString::Printf(TEXT("\"%s\""), *Text);
+		}
+
+		if (Speaker[0] != 0)
+		{
+			OutLines.Add(FString::Printf(TEXT("%s: %s%s"), Speaker, *Text, Expression));
+		}
+		else
+		{
+			OutLines.Add(FString::Printf(TEXT("%s%s"), *Text, Expression));
+		}
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void BenchmarkParseLine(const TArray<FString> &Args)
+{
+	int32 iNumLines = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+
+	TArray<FString> Lines;
+	MakeScriptCorpus(iNumLines, Lines);
+
+	//Tokenizer only, no allocations
+	int64 iTotalLength = 0;
+	double flStart = FPlatformTime::Seconds();
+	for (int32 i=0; i<Lines.Num(); i++)
+	{
+		FDialogueLineTokens Tokens;
+		FDialogueLineTokenizer::Tokenize(Lines.GetData()[i], Tokens);
+		iTotalLength += Tokens.Speaker.Len() + Tokens.Text.Len() + Tokens.Expression.Len();
+	}
+	double flTokenize = FPlatformTime::Seconds() - flStart;
+
+	UE_LOG(LogTemp, Display, TEXT("Tokenize: %d lines in %.3f ms (%.1f ns/line, %lld chars)"), Lines.Num(), flTokenize * 1000.0, flTokenize * 1.0e9 / Lines.Num(), iTotalLength);
+
+#if WITH_EDITOR
+	//Full ParseLine with speaker resolution and string copies
+	FString PreviousSpeaker;
+	flStart = FPlatformTime::Seconds();
+	for (int32 i=0; i<Lines.Num(); i++)
+	{
+		FString StrippedText;
+		FString Speaker;
+		FString CustomName;
+		FString Expression;
+		UDialogue::ParseLine(Lines.GetData()[i], StrippedText, Speaker, CustomName, Expression, PreviousSpeaker);
+	}
+	double flParseLine = FPlatformTime::Seconds() - flStart;
+
+	UE_LOG(LogTemp, Display, TEXT("ParseLine: %d lines in %.3f ms (%.1f ns/line)"), Lines.Num(), flParseLine * 1000.0, flParseLine * 1.0e9 / Lines.Num());
+#endif //
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand BenchmarkParseLineCommand(
+	TEXT("SimpleDialogue.Benchmark.ParseLine"),
+	TEXT("Tokenizes a synthetic script. Optional argument is the number of lines, default 100000."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkParseLine));
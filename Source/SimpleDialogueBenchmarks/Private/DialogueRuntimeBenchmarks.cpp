@@ -0,0 +1,474 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "DialogueBenchmarkScript.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Dialogue/DialogueManager.h"
+#include "Dialogue/DialoguePacing.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagsManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+int32 UDialogueBenchmarkScript::NumLines = 1;
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static const FText &GetBenchmarkText()
+{
+	static const FText Text = FText::FromString(TEXT("This is a line of benchmark dialogue, it is about as long as a normal line"));
+	return Text;
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+FLatentActionInfo UDialogueBenchmarkScript::MakeLatentInfo(int32 InLinkage)
+{
+	return FLatentActionInfo(InLinkage, InLinkage, TEXT("Step"), this);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueBenchmarkScript::OnActivate_Implementation()
+{
+	Line = 0;
+	DialogueBox(EDialogueSpeaker::Target, GetBenchmarkText(), MakeLatentInfo(0));
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+void UDialogueBenchmarkScript::Step(int32 EntryPoint)
+{
+	Line++;
+	if (Line < NumLines)
+	{
+		DialogueBox(Line % 2 ? EDialogueSpeaker::Player : EDialogueSpeaker::Target, GetBenchmarkText(), MakeLatentInfo(Line));
+		return;
+	}
+
+	Deactivate();
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+struct FDialogueBenchmarkResult
+{
+	FString Name;
+	int32 Size;
+	int64 Iterations;
+	double Seconds;
+};
+
+//==============================================================================================================
+// Empty world with a dialogue manager, same setup as FDialogueSimulator
+//==============================================================================================================
+struct FDialogueBenchmarkWorld
+{
+	class UWorld *World = NULL;
+	class AActor *Player = NULL;
+	class AActor *Target = NULL;
+	class UDialogueManager *Manager = NULL;
+
+	FDialogueBenchmarkWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::GamePreview, false, TEXT("DialogueBenchmark"));
+		if (!World)
+			return;
+
+		World->AddToRoot();
+		Player = World->SpawnActor<AActor>();
+		Target = World->SpawnActor<AActor>();
+		if (!Player)
+			return;
+
+		Manager = NewObject<UDialogueManager>(Player);
+		Manager->RegisterComponent();
+		Manager->Initialize(NULL);
+	}
+
+	~FDialogueBenchmarkWorld()
+	{
+		if (Manager)
+		{
+			Manager->ClearDialogue();
+		}
+
+		if (World)
+		{
+			World->RemoveFromRoot();
+			World->DestroyWorld(false);
+		}
+	}
+
+	//
+	UDialogueBenchmarkScript *Speak(int32 InNumLines)
+	{
+		UDialogueBenchmarkScript::NumLines = InNumLines;
+		Manager->SpeakDialogue(TSoftClassPtr<UDialogue>(UDialogueBenchmarkScript::StaticClass()), Player, Target, FGameplayTag(), false);
+		return Cast<UDialogueBenchmarkScript>(const_cast<UDialogue*>(Manager->GetDialogue()));
+	}
+};
+
+//==============================================================================================================
+// Registered tags for the context maps. Native tags can't be added after startup, so these come from a tag ini
+// that is only searched while the benchmark runs. Tags are grouped by a thousand so no tag node gets more
+// children than that.
+//==============================================================================================================
+struct FDialogueBenchmarkTags
+{
+	FString Directory;
+	TArray<FGameplayTag> Tags;
+
+	FDialogueBenchmarkTags(int32 InNum)
+	{
+		Directory = FPaths::ProjectSavedDir() / TEXT("SimpleDialogue") / TEXT("Benchmarks") / TEXT("Tags");
+
+		FString Ini = TEXT("[/Script/GameplayTags.GameplayTagsList]\n");
+		for (int32 i=0; i<InNum; i++)
+		{
+			Ini += FString::Printf(TEXT("+GameplayTagList=(Tag=\"%s\",DevComment=\"\")\n"), *GetName(i));
+		}
+
+		if (!FFileHelper::SaveStringToFile(Ini, *(Directory / TEXT("DialogueBenchmarkTags.ini"))))
+			return;
+
+		UGameplayTagsManager::Get().AddTagIniSearchPath(Directory);
+
+		Tags.Reserve(InNum);
+		for (int32 i=0; i<InNum; i++)
+		{
+			FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*GetName(i)), false);
+			if (!Tag.IsValid())
+			{
+				UE_LOG(LogTemp, Error, TEXT("Benchmark tag %s was not registered"), *GetName(i));
+				Tags.Reset();
+				return;
+			}
+
+			Tags.Add(Tag);
+		}
+	}
+
+	~FDialogueBenchmarkTags()
+	{
+		UGameplayTagsManager::Get().RemoveTagIniSearchPath(Directory);
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	}
+
+	static FString GetName(int32 InIndex)
+	{
+		return FString::Printf(TEXT("Benchmark.Context.Group%d.Tag%d"), InIndex / 1000, InIndex % 1000);
+	}
+};
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void BenchmarkLines(FDialogueBenchmarkWorld &InWorld, TArray<FDialogueBenchmarkResult> &OutResults)
+{
+	const int32 iCount = 100000;
+
+	//DialogueBox on its own, the script never continues
+	{
+		UDialogueBenchmarkScript *pScript = InWorld.Speak(1);
+		FLatentActionInfo LatentInfo = pScript->MakeLatentInfo(1);
+
+		double flStart = FPlatformTime::Seconds();
+		for (int32 i=0; i<iCount; i++)
+		{
+			pScript->DialogueBox(EDialogueSpeaker::Target, GetBenchmarkText(), LatentInfo);
+		}
+		OutResults.Add({ TEXT("DialogueBox"), 0, iCount, FPlatformTime::Seconds() - flStart });
+
+		InWorld.Manager->ClearDialogue();
+	}
+
+	//Skip resumes the script which shows the next line
+	{
+		UDialogueBenchmarkScript *pScript = InWorld.Speak(iCount + 1);
+
+		double flStart = FPlatformTime::Seconds();
+		for (int32 i=0; i<iCount; i++)
+		{
+			pScript->Skip();
+		}
+		OutResults.Add({ TEXT("Skip"), 0, iCount, FPlatformTime::Seconds() - flStart });
+
+		InWorld.Manager->ClearDialogue();
+	}
+
+	//Whole script, size is the number of lines
+	static const int32 ScriptLengths[] = { 10, 100, 1000 };
+	for (int32 i=0; i<UE_ARRAY_COUNT(ScriptLengths); i++)
+	{
+		const int32 iRepeats = FMath::Max(1, iCount / ScriptLengths[i]);
+		double flTotal = 0.0;
+
+		for (int32 j=0; j<iRepeats; j++)
+		{
+			InWorld.Speak(ScriptLengths[i]);
+
+			double flStart = FPlatformTime::Seconds();
+			InWorld.Manager->SkipDialogue(true);
+			flTotal += FPlatformTime::Seconds() - flStart;
+		}
+
+		OutResults.Add({ TEXT("SkipDialogue(true)"), ScriptLengths[i], iRepeats, flTotal });
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void BenchmarkChoices(FDialogueBenchmarkWorld &InWorld, TArray<FDialogueBenchmarkResult> &OutResults)
+{
+	static const int32 MenuSizes[] = { 4, 16, 100 };
+
+	for (int32 i=0; i<UE_ARRAY_COUNT(MenuSizes); i++)
+	{
+		const int32 iChoices = MenuSizes[i];
+
+		//Never ends, every selected choice shows a new line
+		UDialogueBenchmarkScript *pScript = InWorld.Speak(MAX_int32);
+
+		//Every menu is built, queried and then selected, which clears the choices for the next one
+		const int32 iMenus = FMath::Max(50, 20000 / iChoices);
+		const int32 iQueries = 20;
+
+		TArray<int32> Limited;
+		int32 iMaxChoices = 0;
+
+		uint64 iBuildCycles = 0;
+		uint64 iQueryCycles = 0;
+		uint64 iSelectCycles = 0;
+
+		for (int32 j=0; j<iMenus; j++)
+		{
+			uint64 iStart = FPlatformTime::Cycles64();
+			for (int32 k=0; k<iChoices; k++)
+			{
+				pScript->DialogueChoices(GetBenchmarkText(), pScript->MakeLatentInfo(k));
+			}
+			iBuildCycles += FPlatformTime::Cycles64() - iStart;
+
+			iStart = FPlatformTime::Cycles64();
+			for (int32 k=0; k<iQueries; k++)
+			{
+				pScript->GetChoicesLimited(Limited, iMaxChoices);
+			}
+			iQueryCycles += FPlatformTime::Cycles64() - iStart;
+
+			iStart = FPlatformTime::Cycles64();
+			pScript->SelectOption(j % iChoices);
+			iSelectCycles += FPlatformTime::Cycles64() - iStart;
+		}
+
+		//Iterations of the whole menu, sorted after every added choice
+		OutResults.Add({ TEXT("DialogueChoices"), iChoices, iMenus, FPlatformTime::ToSeconds64(iBuildCycles) });
+		OutResults.Add({ TEXT("GetChoicesLimited"), iChoices, (int64)iMenus * iQueries, FPlatformTime::ToSeconds64(iQueryCycles) });
+		OutResults.Add({ TEXT("SelectOption"), iChoices, iMenus, FPlatformTime::ToSeconds64(iSelectCycles) });
+
+		InWorld.Manager->ClearDialogue();
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void BenchmarkContext(FDialogueBenchmarkWorld &InWorld, int32 InMaxSize, TArray<FDialogueBenchmarkResult> &OutResults)
+{
+	static const int32 MapSizes[] = { 1000, 10000, 100000, 1000000 };
+
+	const int32 iOperations = 100000;
+	const FGameplayTag Global;
+
+	//Tags after InMaxSize are never added, for misses
+	FDialogueBenchmarkTags BenchmarkTags(InMaxSize + iOperations);
+	if (BenchmarkTags.Tags.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to register benchmark tags, skipping context benchmarks"));
+		return;
+	}
+
+	const TArray<FGameplayTag> &Tags = BenchmarkTags.Tags;
+	const FGameplayTag *pMissingTags = Tags.GetData() + InMaxSize;
+
+	FRandomStream Random(0);
+	TArray<int32> Indices;
+	Indices.Reserve(iOperations);
+	for (int32 i=0; i<iOperations; i++)
+	{
+		Indices.Add(Random.RandHelper(MAX_int32));
+	}
+
+	int64 iSink = 0;
+
+	for (int32 i=0; i<UE_ARRAY_COUNT(MapSizes); i++)
+	{
+		const int32 iSize = MapSizes[i];
+		if (iSize > InMaxSize)
+			break;
+
+		InWorld.Manager->RestoreContextSnapshot(FDialogueContextSnapshot());
+
+		double flStart = FPlatformTime::Seconds();
+		for (int32 j=0; j<iSize; j++)
+		{
+			InWorld.Manager->AddContext(Tags.GetData()[j], Global, j);
+		}
+		OutResults.Add({ TEXT("AddContext (insert)"), iSize, iSize, FPlatformTime::Seconds() - flStart });
+
+		flStart = FPlatformTime::Seconds();
+		for (int32 j=0; j<iOperations; j++)
+		{
+			InWorld.Manager->AddContext(Tags.GetData()[Indices.GetData()[j] % iSize], Global, -j);
+		}
+		OutResults.Add({ TEXT("AddContext (update)"), iSize, iOperations, FPlatformTime::Seconds() - flStart });
+
+		flStart = FPlatformTime::Seconds();
+		for (int32 j=0; j<iOperations; j++)
+		{
+			iSink += InWorld.Manager->GetContext(Tags.GetData()[Indices.GetData()[j] % iSize], Global);
+		}
+		OutResults.Add({ TEXT("GetContext"), iSize, iOperations, FPlatformTime::Seconds() - flStart });
+
+		flStart = FPlatformTime::Seconds();
+		for (int32 j=0; j<iOperations; j++)
+		{
+			iSink += InWorld.Manager->HasContext(Tags.GetData()[Indices.GetData()[j] % iSize], Global) ? 1 : 0;
+		}
+		OutResults.Add({ TEXT("HasContext (hit)"), iSize, iOperations, FPlatformTime::Seconds() - flStart });
+
+		flStart = FPlatformTime::Seconds();
+		for (int32 j=0; j<iOperations; j++)
+		{
+			iSink += InWorld.Manager->HasContext(pMissingTags[j], Global) ? 1 : 0;
+		}
+		OutResults.Add({ TEXT("HasContext (miss)"), iSize, iOperations, FPlatformTime::Seconds() - flStart });
+	}
+
+	InWorld.Manager->RestoreContextSnapshot(FDialogueContextSnapshot());
+
+	UE_LOG(LogTemp, Verbose, TEXT("Context benchmark checksum %lld"), iSink);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FString GetPluginVersion()
+{
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("SimpleDialogue"));
+	return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("unknown");
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static bool WriteBenchmarkResults(const FString &InFilename, const TArray<FDialogueBenchmarkResult> &InResults)
+{
+	const FString Version = GetPluginVersion();
+	const FString Engine = FEngineVersion::Current().ToString();
+	const FString Configuration = LexToString(FApp::GetBuildConfiguration());
+	const FString Date = FDateTime::UtcNow().ToIso8601();
+
+	FString Output;
+
+	if (InFilename.EndsWith(TEXT(".json")))
+	{
+		Output += FString::Printf(TEXT("{\n\t\"plugin\": \"%s\",\n\t\"engine\": \"%s\",\n\t\"configuration\": \"%s\",\n\t\"date\": \"%s\",\n\t\"results\": [\n"), *Version, *Engine, *Configuration, *Date);
+		for (int32 i=0; i<InResults.Num(); i++)
+		{
+			const FDialogueBenchmarkResult &Result = InResults.GetData()[i];
+			Output += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"size\": %d, \"iterations\": %lld, \"total_ms\": %.4f, \"ns_per_call\": %.2f }%s\n"),
+				*Result.Name, Result.Size, Result.Iterations, Result.Seconds * 1000.0, Result.Seconds * 1.0e9 / Result.Iterations, i + 1 < InResults.Num() ? TEXT(",") : TEXT(""));
+		}
+		Output += TEXT("\t]\n}\n");
+	}
+	else
+	{
+		Output += FString::Printf(TEXT("# SimpleDialogue %s, engine %s, %s, %s\n"), *Version, *Engine, *Configuration, *Date);
+		Output += TEXT("name,size,iterations,total_ms,ns_per_call\n");
+		for (int32 i=0; i<InResults.Num(); i++)
+		{
+			const FDialogueBenchmarkResult &Result = InResults.GetData()[i];
+			Output += FString::Printf(TEXT("%s,%d,%lld,%.4f,%.2f\n"), *Result.Name, Result.Size, Result.Iterations, Result.Seconds * 1000.0, Result.Seconds * 1.0e9 / Result.Iterations);
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *InFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static void BenchmarkRuntime(const TArray<FString> &Args)
+{
+	int32 iMaxContext = 100000;
+	FString Filename;
+
+	for (int32 i=0; i<Args.Num(); i++)
+	{
+		if (Args[i].StartsWith(TEXT("Output=")))
+		{
+			Filename = Args[i].Mid(7);
+		}
+		else if (Args[i].IsNumeric())
+		{
+			iMaxContext = FMath::Max(1000, FCString::Atoi(*Args[i]));
+		}
+	}
+
+	if (Filename.IsEmpty())
+	{
+		Filename = FPaths::ProjectSavedDir() / TEXT("SimpleDialogue") / TEXT("Benchmarks") / FString::Printf(TEXT("Runtime-%s-%s.csv"), *GetPluginVersion(), *FDateTime::Now().ToString());
+	}
+
+	FDialogueBenchmarkWorld World;
+	if (!World.Manager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create benchmark world"));
+		return;
+	}
+
+	TArray<FDialogueBenchmarkResult> Results;
+	FDialoguePacing::FScopedDisable NoPacing;
+
+	BenchmarkLines(World, Results);
+	BenchmarkChoices(World, Results);
+	BenchmarkContext(World, iMaxContext, Results);
+
+	for (int32 i=0; i<Results.Num(); i++)
+	{
+		const FDialogueBenchmarkResult &Result = Results.GetData()[i];
+		UE_LOG(LogTemp, Display, TEXT("%-24s %8d: %10.1f ns/call (%lld calls)"), *Result.Name, Result.Size, Result.Seconds * 1.0e9 / Result.Iterations, Result.Iterations);
+	}
+
+	if (WriteBenchmarkResults(Filename, Results))
+	{
+		UE_LOG(LogTemp, Display, TEXT("Benchmark results written to %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write benchmark results to %s"), *Filename);
+	}
+}
+
+//==============================================================================================================
+//
+//==============================================================================================================
+static FAutoConsoleCommand BenchmarkRuntimeCommand(
+	TEXT("SimpleDialogue.Benchmark.Runtime"),
+	TEXT("Measures DialogueBox, Skip, SkipDialogue, DialogueChoices, SelectOption, GetChoicesLimited and context access. Optional arguments: largest context map size (default 100000, up to 1000000, every size registers that many gameplay tags first) and Output=<file.csv|file.json>."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkRuntime));
@@ -0,0 +1,8 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Modules/ModuleManager.h"
+
+//Only console commands, nothing to start or shut down
+IMPLEMENT_MODULE(FDefaultModuleImpl, SimpleDialogueBenchmarks)
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+//Benchmark console commands. Not built for shipping, see TargetConfigurationDenyList in the .uplugin
+public class SimpleDialogueBenchmarks : ModuleRules
+{
+	public SimpleDialogueBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+			);
+			
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"Projects",
+				"SimpleDialogue",
+			}
+			);
+	}
+}
@@ -24,6 +24,7 @@
 #include "Widgets/Layout/SScrollBox.h"
 #include "DetailLayoutBuilder.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSearchBox.h"
 
 #include "Editor/PropertyEditor/Public/ISinglePropertyView.h"
 
@@ -33,10 +34,15 @@
 #include "Editor/EditorStyle/Public/EditorStyleSet.h"
 #include "Widgets/Input/SMultiLineEditableTextBox.h"
 #include "Dialogue/DialogueInspectorAsset.h"
+#include "Dialogue/DialogueStats.h"
 #include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueLineTokenizer.h"
 #include "Runtime/Engine/Public/Internationalization/StringTable.h"
 #include "Editor/Kismet/Public/BlueprintEditorModule.h"
 #include "EdGraph/EdGraphPin.h"
+#include "Inspector/DialogueLineDiff.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 #define LOCTEXT_NAMESPACE "FDialogueInspectorEditor" 
 
@@ -181,37 +187,24 @@ TSharedRef<SDockTab> FDialogueInspectorEditor::SpawnTab_TextBox(const FSpawnTabA
 //===========================================================================================================================
 void FDialogueInspectorEditor::OnScrollChanged(float Value)
 {
-	if (!bChangingScroll && TextWidgetsScroll.IsValid() && TextEditor.IsValid())
+	if (!bChangingScroll && TextListView.IsValid() && TextEditor.IsValid())
 	{
 		TSharedPtr<const SScrollBar> Bar = TextEditor->GetVScrollBar();
 
 		float flNewValue = Bar->DistanceFromTop() / (Bar->DistanceFromTop() + Bar->DistanceFromBottom());
 
-		//UE_LOG(LogTemp, Display, TEXT("Value: %.2f New value %.2f"), Value, flNewValue);
-
+		//List view scroll offset is in items
 		bChangingScroll = true;
-		TextWidgetsScroll->SetScrollOffset(flNewValue * TextWidgetsScroll->GetScrollOffsetOfEnd());
+		TextListView->SetScrollOffset(flNewValue * FilteredTextItems.Num());
 		bChangingScroll = false;
 	}
 }
 
 //===========================================================================================================================
-// 
+// The text box can only be scrolled by moving to a line, which would fight with typing. Only the editor drives the list
 //===========================================================================================================================
 void FDialogueInspectorEditor::OnWidgetsScrollChanged(float Value)
 {
-	if (!bChangingScroll && TextWidgetsScroll.IsValid() && TextEditor.IsValid())
-	{
-		float flNewValue = TextWidgetsScroll->GetScrollOffset() / TextWidgetsScroll->GetScrollOffsetOfEnd();
-
-		UE_LOG(LogTemp, Display, TEXT("Value: %.2f"), flNewValue);
-
-		bChangingScroll = true;
-		//TextEditor->GetVScrollBar()->SetState(flNewValue, 0.0f);
-		bChangingScroll = false;
-
-		//TextWidgetsScroll->SetScrollOffset(flNewValue * TextWidgetsScroll->GetScrollOffsetOfEnd());
-	}
 }
 
 //===========================================================================================================================
@@ -227,118 +220,132 @@ void FDialogueInspectorEditor::SetEditorText(const FText& Text, ETextCommit::Typ
 	TArray<FString> Strings;
 	Text.ToString().ParseIntoArray(Strings, TEXT("\n"), true);
 
-	TArray<int32> NewIndices;
-	TArray<int32> OldIndices;
-	NewIndices.Reserve(Strings.Num());
-	OldIndices.Reserve(Texts.Num());
-
-	TArray<FString> OldStrings;
-	OldStrings.SetNum(Texts.Num());
-	for (int32 i=0; i<Texts.Num(); i++)
+	//Only the text part of the line is compared
+	for (int32 i=0; i<Strings.Num(); i++)
 	{
-		OldStrings.GetData()[i] = Texts.GetData()[i].ToString();
-		OldIndices.Add(i);
+		FDialogueLineTokens Tokens;
+		FDialogueLineTokenizer::Tokenize(Strings.GetData()[i], Tokens);
+
+		FString StrippedText(Tokens.Text);
+		Strings.GetData()[i] = MoveTemp(StrippedText);
 	}
 
-	for (int32 i=0; i<Strings.Num(); i++)
+	if (TextStrings.Num() != Texts.Num())
 	{
-		Strings.GetData()[i].RemoveFromEnd(TEXT("\n"));
-		Strings.GetData()[i].RemoveFromEnd(TEXT("\r"));
+		TextStrings.SetNum(Texts.Num());
+		for (int32 i=0; i<Texts.Num(); i++)
+		{
+			TextStrings.GetData()[i] = Texts.GetData()[i].ToString();
+		}
+	}
 
-		FString Line = Strings.GetData()[i];
-		FString Speaker;
-		FString CustomName;
-		FString Expression;
-		FString PreviousSpeaker;
-		UDialogue::ParseLine(Line, Strings.GetData()[i], Speaker, CustomName, Expression, PreviousSpeaker);
+	//Without a diff there is no telling which old line a new one replaces, so no string table entry is changed.
+	//Lines that are already in a string table still use it, the rest stay as plain text
+	TArray<FDialogueLineEdit> Edits;
+	const bool bDiffed = FDialogueLineDiff::Diff(TextStrings, Strings, Edits);
+	if (!bDiffed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Too many changes to diff, %d lines were not updated in the string table"), Strings.Num());
 
-		NewIndices.Add(i);
+		FNotificationInfo Info(LOCTEXT("TooManyChanges", "Too many changes at once, string table entries were not updated. Make smaller edits to change existing lines."));
+		Info.ExpireDuration = 8.0f;
+		FSlateNotificationManager::Get().AddNotification(Info);
 	}
 
 	TArray<FText> NewTexts;
 	NewTexts.SetNum(Strings.Num());
-	for (int32 i=0; i<Strings.Num(); i++)
-	{
-		NewTexts.GetData()[i] = FText::FromString(Strings.GetData()[i]);
 
-		bool bFound = false;
-		for (int32 j=0; j< OldStrings.Num(); j++)
-		{
-			if (!OldIndices.Contains(j))
-				continue;
+	TArray<bool> NewResolved;
+	NewResolved.SetNumZeroed(Strings.Num());
 
-			if (Strings.GetData()[i].Equals(OldStrings.GetData()[j], ESearchCase::CaseSensitive))
-			{
-				bFound = true;
-				NewTexts.GetData()[i] = Texts.GetData()[j];
+	//Deleted lines that show up again somewhere else are moves, keep their text as is
+	TMultiMap<FString, int32> DeletedLines;
+	TArray<bool> OldConsumed;
+	OldConsumed.SetNumZeroed(Texts.Num());
 
-				NewIndices.Remove(i);
-				OldIndices.Remove(j);
-				break;
-			}
+	for (int32 i=0; i<Edits.Num(); i++)
+	{
+		const FDialogueLineEdit &Edit = Edits.GetData()[i];
+		if (Edit.Type == EDialogueLineEditType::Keep)
+		{
+			NewTexts.GetData()[Edit.NewIndex] = Texts.GetData()[Edit.OldIndex];
+			NewResolved.GetData()[Edit.NewIndex] = true;
+			OldConsumed.GetData()[Edit.OldIndex] = true;
 		}
+		else if (Edit.Type == EDialogueLineEditType::Delete)
+		{
+			DeletedLines.Add(TextStrings.GetData()[Edit.OldIndex], Edit.OldIndex);
+		}
+	}
 
-		if (bFound)
+	for (int32 i=0; i<Edits.Num(); i++)
+	{
+		const FDialogueLineEdit &Edit = Edits.GetData()[i];
+		if (Edit.Type != EDialogueLineEditType::Insert)
 			continue;
 
-		FString FakeKey;
-
-		if (UDialogue::FixTextToUseStringTable(NewTexts.GetData()[i], FakeKey, PropBeingEdited->DefaultStringTable, true))
-		{
-			NewIndices.Remove(i);
+		int32 *pOld = DeletedLines.Find(Strings.GetData()[Edit.NewIndex]);
+		if (!pOld)
 			continue;
-		}
 
-		if (UDialogue::FixTextToUseStringTable(NewTexts.GetData()[i], FakeKey, PropBeingEdited->StringTable, true))
-		{
-			NewIndices.Remove(i);
-			continue;
-		}
+		int32 iOld = *pOld;
+		DeletedLines.Remove(Strings.GetData()[Edit.NewIndex], iOld);
+
+		NewTexts.GetData()[Edit.NewIndex] = Texts.GetData()[iOld];
+		NewResolved.GetData()[Edit.NewIndex] = true;
+		OldConsumed.GetData()[iOld] = true;
 	}
 
-	if (OldIndices.Num() > 0 && NewIndices.Num() > 0)
+	//Go through each block of changes between kept lines. Remaining deletes and inserts in a block are paired up as edits
+	TArray<int32> HunkOld;
+	TArray<int32> HunkNew;
+	for (int32 i=0; i<=Edits.Num(); i++)
 	{
-		if (NewIndices.Num() == 1 && OldIndices.Num() == 1)
-		{
-			int32 iOld = OldIndices.GetData()[0];
-			int32 iNew = NewIndices.GetData()[0];
-			UE_LOG(LogTemp, Display, TEXT("From %d to %d. Updating text in stringtable from \"%s\" to \"%s\""), iOld, iNew, *Texts.GetData()[iOld].ToString(), *NewTexts.GetData()[iNew].ToString());
-			UDialogue::ChangeTextInStringTable(PropBeingEdited->StringTable, Texts.GetData()[OldIndices.GetData()[0]], NewTexts.GetData()[NewIndices.GetData()[0]]);
-		}
-		else if (NewIndices.Num() == OldIndices.Num())
+		const FDialogueLineEdit *pEdit = i < Edits.Num() ? &Edits.GetData()[i] : NULL;
+		if (pEdit && pEdit->Type != EDialogueLineEditType::Keep)
 		{
-			bool bAllIndicesMatch = true;
-			for (int32 i=0; i<NewIndices.Num(); i++)
+			if (pEdit->Type == EDialogueLineEditType::Delete && !OldConsumed.GetData()[pEdit->OldIndex])
 			{
-				if (NewIndices.GetData()[i] != OldIndices.GetData()[i])
-				{
-					bAllIndicesMatch = false;
-					break;
-				}
-			}
-			
-			if (bAllIndicesMatch)
-			{
-				for (int32 i = 0; i < NewIndices.Num(); i++)
-				{
-					int32 iIndex = NewIndices.GetData()[i];
-
-					UE_LOG(LogTemp, Display, TEXT("Index %d. Updating text in stringtable from \"%s\" to \"%s\""), iIndex, *Texts.GetData()[iIndex].ToString(), *NewTexts.GetData()[iIndex].ToString());
-					UDialogue::ChangeTextInStringTable(PropBeingEdited->StringTable, Texts.GetData()[iIndex], NewTexts.GetData()[iIndex]);
-				}
+				HunkOld.Add(pEdit->OldIndex);
 			}
-			else
+			else if (pEdit->Type == EDialogueLineEditType::Insert && !NewResolved.GetData()[pEdit->NewIndex])
 			{
-				UE_LOG(LogTemp, Error, TEXT("Failed to update %d texts!"), NewIndices.Num());
+				HunkNew.Add(pEdit->NewIndex);
 			}
+
+			continue;
 		}
-		else
+
+		//Old lines are only used up when their entry is actually changed
+		int32 iNextOld = 0;
+		for (int32 j=0; j<HunkNew.Num(); j++)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to update %d texts!"), NewIndices.Num());
+			int32 iNew = HunkNew.GetData()[j];
+			FText &NewText = NewTexts.GetData()[iNew];
+			NewText = FText::FromString(Strings.GetData()[iNew]);
+
+			//Line already exists in one of the string tables
+			FString FakeKey;
+			if (UDialogue::FixTextToUseStringTable(NewText, FakeKey, PropBeingEdited->DefaultStringTable, true))
+				continue;
+
+			if (UDialogue::FixTextToUseStringTable(NewText, FakeKey, PropBeingEdited->StringTable, true))
+				continue;
+
+			if (bDiffed && iNextOld < HunkOld.Num())
+			{
+				int32 iOld = HunkOld.GetData()[iNextOld++];
+				UE_LOG(LogTemp, Display, TEXT("From %d to %d. Updating text in stringtable from \"%s\" to \"%s\""), iOld, iNew, *TextStrings.GetData()[iOld], *Strings.GetData()[iNew]);
+				UDialogue::ChangeTextInStringTable(PropBeingEdited->StringTable, Texts.GetData()[iOld], NewText);
+			}
 		}
+
+		HunkOld.Reset();
+		HunkNew.Reset();
 	}
 
-	Texts = NewTexts;
+	Texts = MoveTemp(NewTexts);
+	TextStrings = MoveTemp(Strings);
 
 	UpdateTextWidgets();
 }
@@ -348,198 +355,289 @@ void FDialogueInspectorEditor::SetEditorText(const FText& Text, ETextCommit::Typ
 //===========================================================================================================================
 TSharedRef<SDockTab> FDialogueInspectorEditor::SpawnTab_Changes(const FSpawnTabArgs& Args)
 {
-	TextWidgetsScroll = SNew(SScrollBox);
+	TextListView = SNew(SListView<FTextInspectorDataPtr>)
+		.ListItemsSource(&FilteredTextItems)
+		.OnGenerateRow(this, &FDialogueInspectorEditor::OnGenerateTextRow)
+		.SelectionMode(ESelectionMode::None);
 
 	// Spawn the tab
 	return
 		SNew(SDockTab)
 		.Label(LOCTEXT("ChangesTab_Title", "Changes"))
 		[
-			TextWidgetsScroll.ToSharedRef()
+			SNew(SVerticalBox)
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("ChangesTab_Filter", "Filter texts..."))
+				.OnTextChanged(this, &FDialogueInspectorEditor::OnFilterTextChanged)
+			]
+
+			+ SVerticalBox::Slot()
+			.FillHeight(1.0f)
+			[
+				TextListView.ToSharedRef()
+			]
 		];
 }
 
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FDialogueInspectorEditor::OnFilterTextChanged(const FText& InFilterText)
+{
+	FilterString = InFilterText.ToString();
+	UpdateFilteredTexts();
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FDialogueInspectorEditor::UpdateFilteredTexts()
+{
+	FilteredTextItems.Reset(TextItems.Num());
+
+	for (int32 i=0; i<TextItems.Num(); i++)
+	{
+		const FTextInspectorDataPtr &Item = TextItems.GetData()[i];
+		if (FilterString.Len() > 0 && !Item->Text.ToString().Contains(FilterString) && !Item->KeyNameText.ToString().Contains(FilterString))
+			continue;
+
+		FilteredTextItems.Add(Item);
+	}
+
+	if (TextListView.IsValid())
+	{
+		TextListView->RequestListRefresh();
+	}
+}
+
 //===========================================================================================================================
 // 
 //===========================================================================================================================
 void FDialogueInspectorEditor::UpdateTextWidgets()
 {
-	if (TextWidgets.Num() != Texts.Num())
+	TArray<FTextInspectorDataPtr> OldItems = MoveTemp(TextItems);
+	TextItems.Reset(Texts.Num());
+
+	for (int32 i=0; i<Texts.Num(); i++)
 	{
-		TextWidgetsScroll->ClearChildren();
+		const FText &Text = Texts.GetData()[i];
 
-		//Destroy excess ones
-		while (TextWidgets.Num() > Texts.Num())
+		//Keep the already resolved row if nothing changed
+		if (i < OldItems.Num() && OldItems.GetData()[i]->Text.IdenticalTo(Text))
 		{
-			TextWidgets.RemoveAt(TextWidgets.Num()-1);
+			TextItems.Add(OldItems.GetData()[i]);
+			continue;
 		}
 
-		//Create new ones
-		while (TextWidgets.Num() < Texts.Num())
+		FName TableId;
+		FString Key;
+		FTextInspector::GetTableIdAndKey(Text, TableId, Key);
+
+		FTextInspectorDataPtr NewData = MakeShared<FTextInspectorData>();
+		NewData->Text = Text;
+		NewData->NamespaceText = FText::FromName(TableId);
+		NewData->KeyNameText = FText::FromString(Key);
+
+		//Gathered line still matches, no need to search the graphs for the speaker
+		if (i < ScriptLines.Num() && ScriptLines.GetData()[i].Text.IdenticalTo(Text))
 		{
-			FTextInspectorData NewData;
-			NewData.TextWidget = SNew(STextBlock).TextStyle(&MediumTextStyle);
-			NewData.SpeakerWidget = SNew(STextBlock).TextStyle(&MediumTextStyle);
-			NewData.KeyNameWidget = SNew(STextBlock).TextStyle(&SmallTextStyle);
-			NewData.NamespaceWidget = SNew(STextBlock).TextStyle(&SmallTextStyle);
-			NewData.OpenButtonWidget = SNew(SButton).Text(FText::FromString(TEXT("Open"))).TextStyle(&TextStyle);
-			NewData.HorizontalBox = SNew(SHorizontalBox)
+			const FDialogueScriptLine &Line = ScriptLines.GetData()[i];
+			NewData->bIsResolved = true;
+			NewData->SpeakerText = Line.Speaker.Len() > 0 ? FText::FromString(FString::Printf(TEXT("%s: "), *Line.Speaker)) : FText::GetEmpty();
+			NewData->NodeGuid = Line.NodeGuid;
+			NewData->PinId = Line.PinId;
+		}
+
+		TextItems.Add(NewData);
+	}
+
+	UpdateFilteredTexts();
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FDialogueInspectorEditor::ResolveTextItem(FTextInspectorData &InItem) const
+{
+	InItem.bIsResolved = true;
+
+	class UEdGraphPin *pPin = PropBeingEdited != NULL ? UDialogue::FindPinWithText(PropBeingEdited->DialogueScript, InItem.Text) : NULL;
+	InItem.Pin = FEdGraphPinReference(pPin);
 
+	FString Speaker;
+	FString CustomName;
+
+	if (pPin && pPin->GetOwningNode())
+	{
+		//Go through pins in node
+		for (int32 k = 0; k < pPin->GetOwningNode()->Pins.Num(); k++)
+		{
 			//
-			+ SHorizontalBox::Slot()
-			.AutoWidth()
-			.HAlign(HAlign_Right)
-			.Padding(5, 0)
-			[
-				NewData.OpenButtonWidget.ToSharedRef()
-			]
+			class UEdGraphPin* pOtherPin = pPin->GetOwningNode()->Pins.GetData()[k];
+			if (!pOtherPin)
+				continue;
 
 			//
-			+ SHorizontalBox::Slot()
-			.AutoWidth()
-			.HAlign(HAlign_Left)
-			[
-				SNew(SVerticalBox)
+			if (pOtherPin->LinkedTo.Num() > 0)
+				continue;
 
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SHorizontalBox)
-
-					//
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.HAlign(HAlign_Left)
-					[
-						NewData.SpeakerWidget.ToSharedRef()
-					]
-
-					//
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.HAlign(HAlign_Left)
-					[
-						NewData.TextWidget.ToSharedRef()
-					]
-				]
+			if (pOtherPin->Direction != EEdGraphPinDirection::EGPD_Input)
+				continue;
 
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SHorizontalBox)
-
-					//
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.HAlign(HAlign_Left)
-					[
-						NewData.NamespaceWidget.ToSharedRef()
-					]
-
-					//
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.HAlign(HAlign_Left)
-					[
-						SNew(STextBlock).Font(TextStyle.Font).Text(FText::FromString(TEXT(".")))
-					]
-
-					//
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.HAlign(HAlign_Left)
-					[
-						NewData.KeyNameWidget.ToSharedRef()
-					]
-				]
-			];
+			static const FName Name_Speaker = TEXT("Speaker");
+			if (pOtherPin->PinName == Name_Speaker)
+			{
+				Speaker = pOtherPin->DefaultValue;
+			}
 
-			TextWidgets.Add(NewData);
-		}
+			static const FName Name_CustomName = TEXT("InCustomName");
+			if (pOtherPin->PinName == Name_CustomName)
+			{
+				//CustomName = pOtherPin->DefaultValue;
 
-		//Add them to the scroll box
-		for (int32 i=0; i<TextWidgets.Num(); i++)
-		{
-			TextWidgetsScroll->AddSlot()
-				.VAlign(VAlign_Center)
-				.HAlign(HAlign_Fill)
-				.Padding(0.0f)
-				[
-					TextWidgets.GetData()[i].HorizontalBox.ToSharedRef()
-				];
+				if (pOtherPin->DefaultValue.Split(TEXT("."), NULL, &CustomName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+				{
+					CustomName.Split(TEXT("\""), &CustomName, NULL, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+				}
+			}
 		}
 	}
 
-	for (int32 i=0; i<TextWidgets.Num(); i++)
+	if (Speaker == TEXT("Custom"))
 	{
-		FName TableId;
-		FString Key;
-		FTextInspector::GetTableIdAndKey(Texts.GetData()[i], TableId, Key);
+		InItem.SpeakerText = FText::FromString(FString::Printf(TEXT("%s: "), *CustomName));
+	}
+	else if (Speaker.Len() > 0)
+	{
+		InItem.SpeakerText = FText::FromString(FString::Printf(TEXT("%s: "), *Speaker));
+	}
+	else
+	{
+		InItem.SpeakerText = FText::GetEmpty();
+	}
+}
 
-		class UEdGraphPin *pPin = UDialogue::FindPinWithText(PropBeingEdited->DialogueScript, Texts.GetData()[i]);
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+TSharedRef<ITableRow> FDialogueInspectorEditor::OnGenerateTextRow(FTextInspectorDataPtr InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	if (!InItem->bIsResolved)
+	{
+		ResolveTextItem(*InItem);
+	}
 
-		FString Speaker;
-		FString CustomName;
+	return
+	SNew(STableRow<FTextInspectorDataPtr>, OwnerTable)
+	.Padding(0.0f)
+	[
+		SNew(SHorizontalBox)
 
-		if (pPin && pPin->GetOwningNode())
-		{
-			//Go through pins in node
-			for (int32 k = 0; k < pPin->GetOwningNode()->Pins.Num(); k++)
-			{
-				//
-				class UEdGraphPin* pOtherPin = pPin->GetOwningNode()->Pins.GetData()[k];
-				if (!pOtherPin)
-					continue;
+		//
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.HAlign(HAlign_Right)
+		.Padding(5, 0)
+		[
+			SNew(SButton)
+			.Text(FText::FromString(TEXT("Open")))
+			.TextStyle(&TextStyle)
+			.IsEnabled_Lambda([InItem]() { return InItem->Pin.Get() != NULL || InItem->NodeGuid.IsValid(); })
+			.OnClicked(this, &FDialogueInspectorEditor::OnClickItem, InItem)
+		]
+
+		//
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.HAlign(HAlign_Left)
+		[
+			SNew(SVerticalBox)
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			[
+				SNew(SHorizontalBox)
 
 				//
-				if (pOtherPin->LinkedTo.Num() > 0)
-					continue;
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Left)
+				[
+					SNew(STextBlock).TextStyle(&MediumTextStyle).Text(InItem->SpeakerText)
+				]
 
-				if (pOtherPin->Direction != EEdGraphPinDirection::EGPD_Input)
-					continue;
+				//
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Left)
+				[
+					SNew(STextBlock).TextStyle(&MediumTextStyle).Text(InItem->Text)
+				]
+			]
 
-				static const FName Name_Speaker = TEXT("Speaker");
-				if (pOtherPin->PinName == Name_Speaker)
-				{
-					Speaker = pOtherPin->DefaultValue;
-				}
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			[
+				SNew(SHorizontalBox)
 
-				static const FName Name_CustomName = TEXT("InCustomName");
-				if (pOtherPin->PinName == Name_CustomName)
-				{
-					//CustomName = pOtherPin->DefaultValue;
+				//
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Left)
+				[
+					SNew(STextBlock).TextStyle(&SmallTextStyle).Text(InItem->NamespaceText)
+				]
 
-					if (pOtherPin->DefaultValue.Split(TEXT("."), NULL, &CustomName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
-					{
-						CustomName.Split(TEXT("\""), &CustomName, NULL, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-					}
-				}
-			}
-		}
+				//
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Left)
+				[
+					SNew(STextBlock).Font(TextStyle.Font).Text(FText::FromString(TEXT(".")))
+				]
 
-		if (Speaker == TEXT("Custom"))
-		{
-			TextWidgets.GetData()[i].SpeakerWidget->SetText(FText::FromString(FString::Printf(TEXT("%s: "), *CustomName)));
-		}
-		else if (Speaker.Len() > 0)
-		{
-			TextWidgets.GetData()[i].SpeakerWidget->SetText(FText::FromString(FString::Printf(TEXT("%s: "), *Speaker)));
-		}
-		else
-		{
-			TextWidgets.GetData()[i].SpeakerWidget->SetText(FText::GetEmpty());
-		}
+				//
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Left)
+				[
+					SNew(STextBlock).TextStyle(&SmallTextStyle).Text(InItem->KeyNameText)
+				]
+			]
+		]
+	];
+}
 
-		TextWidgets.GetData()[i].OpenButtonWidget->SetOnClicked(FOnClicked::CreateSP(this, &FDialogueInspectorEditor::OnClick, pPin));
-		TextWidgets.GetData()[i].OpenButtonWidget->SetEnabled(pPin != NULL);
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+FReply FDialogueInspectorEditor::OnClickItem(FTextInspectorDataPtr InItem)
+{
+	if (!InItem.IsValid())
+		return FReply::Handled();
 
-		TextWidgets.GetData()[i].TextWidget->SetText(Texts.GetData()[i]);
+	//Pin might have been reconstructed since the row was created
+	class UEdGraphPin *pPin = InItem->Pin.Get();
+	if (!pPin && InItem->NodeGuid.IsValid() && IsValid(PropBeingEdited) && PropBeingEdited->DialogueScript != NULL)
+	{
+		pPin = FDialogueScriptDerivedData::FindPin(Cast<UBlueprint>(PropBeingEdited->DialogueScript->ClassGeneratedBy), InItem->NodeGuid, InItem->PinId);
+		InItem->Pin = FEdGraphPinReference(pPin);
+	}
 
-		TextWidgets.GetData()[i].NamespaceWidget->SetText(FText::FromName(TableId));
-		TextWidgets.GetData()[i].KeyNameWidget->SetText(FText::FromString(Key));
+	if (!pPin)
+	{
+		ResolveTextItem(*InItem);
+		pPin = InItem->Pin.Get();
 	}
+
+	return OnClick(pPin);
 }
 
 //===========================================================================================================================
@@ -551,21 +649,28 @@ FReply FDialogueInspectorEditor::OnClick(class UEdGraphPin* InPin)
 
 	if (InPin != NULL)
 	{
-		static const FName BpEditorModuleName("Kismet");
-		FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>(BpEditorModuleName);
-
 		//If object, then check if blueprint object
-		class UBlueprint* pBlueprint = Cast<UBlueprint>(PropBeingEdited->DialogueScript->ClassGeneratedBy);
-		if (pBlueprint)
-		{
-			TSharedRef< IBlueprintEditor > NewKismetEditor = BlueprintEditorModule.CreateBlueprintEditor(EToolkitMode::Standalone, false, pBlueprint, false);
-			NewKismetEditor->JumpToPin(InPin);
-		}
+		JumpToPin(Cast<UBlueprint>(PropBeingEdited->DialogueScript->ClassGeneratedBy), InPin);
 	}
 
 	return FReply::Handled();
 }
 
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FDialogueInspectorEditor::JumpToPin(class UBlueprint *InBlueprint, class UEdGraphPin *InPin)
+{
+	if (!InBlueprint || !InPin)
+		return;
+
+	static const FName BpEditorModuleName("Kismet");
+	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>(BpEditorModuleName);
+
+	TSharedRef< IBlueprintEditor > NewKismetEditor = BlueprintEditorModule.CreateBlueprintEditor(EToolkitMode::Standalone, false, InBlueprint, false);
+	NewKismetEditor->JumpToPin(InPin);
+}
+
 //===========================================================================================================================
 // 
 //===========================================================================================================================
@@ -598,7 +703,7 @@ bool FDialogueInspectorEditor::IsTickable() const
 //===========================================================================================================================
 TStatId FDialogueInspectorEditor::GetStatId() const
 {
-	return TStatId();
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FDialogueInspectorEditor, STATGROUP_SimpleDialogue);
 }
 
 //===========================================================================================================================
@@ -627,7 +732,16 @@ void FDialogueInspectorEditor::CheckImportText()
 	if (!PropBeingEdited->ImportDialogueFromScript)
 		return;
 
-	UDialogue::GatherAllTexts(PropBeingEdited->DialogueScript, Texts);
+	//Unchanged scripts come from the derived data cache with speakers and pins already resolved
+	FDialogueScriptDerivedData::GetLines(Cast<UBlueprint>(PropBeingEdited->DialogueScript->ClassGeneratedBy), ScriptLines);
+
+	Texts.Reset(ScriptLines.Num());
+	for (int32 i = 0; i < ScriptLines.Num(); i++)
+	{
+		Texts.Add(ScriptLines.GetData()[i].Text);
+	}
+
+	TextStrings.Reset();
 
 	//UE_LOG(LogTemp, Error, TEXT("Number of texts: %d"), Texts.Num());
 
@@ -813,4 +927,4 @@ void FDialogueInspectorEditor::ShowObjectDetails(UObject* ObjectProperties)
 
 #undef LOCTEXT_NAMESPACE
 
-#undef BOX_BRUSH
\ No newline at end of file
+#undef BOX_BRUSH
@@ -13,21 +13,31 @@
 #include "Widgets/Layout/SGridPanel.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Input/SMultiLineEditableTextBox.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Dialogue/DialogueScriptDerivedData.h"
 
 //===========================================================================================================================
-//
+// One row in the changes list. Speaker and pin are resolved only once the row is first shown.
 //===========================================================================================================================
 struct FTextInspectorData
 {
-	FText OldText;
-	TSharedPtr<SHorizontalBox> HorizontalBox;
-	TSharedPtr<STextBlock> SpeakerWidget;
-	TSharedPtr<STextBlock> TextWidget;
-	TSharedPtr<STextBlock> NamespaceWidget;
-	TSharedPtr<STextBlock> KeyNameWidget;
-	TSharedPtr<SButton> OpenButtonWidget;
+	FText Text;
+	FText NamespaceText;
+	FText KeyNameText;
+
+	bool bIsResolved = false;
+	FText SpeakerText;
+	FEdGraphPinReference Pin;
+
+	//From the derived data cache, used to find the pin when clicked
+	FGuid NodeGuid;
+	FGuid PinId;
 };
 
+typedef TSharedPtr<FTextInspectorData> FTextInspectorDataPtr;
+
 //===========================================================================================================================
 // Editor for dialogue inspector assets 
 //===========================================================================================================================
@@ -85,10 +95,28 @@ public:
 
 	FReply OnClick(class UEdGraphPin *InPin);
 
+	//Opens the blueprint editor and focuses the pin
+	static void JumpToPin(class UBlueprint *InBlueprint, class UEdGraphPin *InPin);
+	FReply OnClickItem(FTextInspectorDataPtr InItem);
+
+	//
+	TSharedRef<ITableRow> OnGenerateTextRow(FTextInspectorDataPtr InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	void ResolveTextItem(FTextInspectorData &InItem) const;
+
+	//
+	void OnFilterTextChanged(const FText& InFilterText);
+	void UpdateFilteredTexts();
+
 private:
 
 	TArray<FText> Texts;
 
+	//Texts as strings, same order as Texts
+	TArray<FString> TextStrings;
+
+	//Lines gathered on import, same order as Texts until the texts are edited
+	TArray<FDialogueScriptLine> ScriptLines;
+
 	//===========================================================================================================================
 	// 
 	//===========================================================================================================================
@@ -102,8 +130,10 @@ protected:
 
 	TSharedPtr<SMultiLineEditableTextBox> TextEditor;
 	TSharedPtr<SScrollBox> PropertyEditor;
-	TSharedPtr<SScrollBox> TextWidgetsScroll;
-	TArray<FTextInspectorData> TextWidgets;
+	TSharedPtr<SListView<FTextInspectorDataPtr>> TextListView;
+	TArray<FTextInspectorDataPtr> TextItems;
+	TArray<FTextInspectorDataPtr> FilteredTextItems;
+	FString FilterString;
 
 	class UDialogueInspectorAsset *PropBeingEdited = NULL;
 
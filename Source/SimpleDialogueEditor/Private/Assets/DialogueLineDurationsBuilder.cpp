@@ -0,0 +1,201 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Assets/DialogueLineDurationsBuilder.h"
+#include "Dialogue/DialogueLineDurations.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Interfaces/IPluginManager.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Internationalization/TextLocalizationManager.h"
+#include "Internationalization/TextLocalizationResource.h"
+#include "Misc/Paths.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueLineDurationsSource
+{
+	FName TableId;
+	FString Namespace;
+	FString Key;
+	FString SourceString;
+};
+
+//===========================================================================================================================
+// Tables under /Game and the content of project plugins, hashed so an edit can be noticed without rebuilding
+//===========================================================================================================================
+static void GatherStringTables(TArray<FDialogueLineDurationsSource> &OutSources, TMap<FName, uint32> &OutHashes)
+{
+	IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UStringTable::StaticClass()->GetClassPathName());
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+
+	TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetEnabledPluginsWithContent();
+	for (int32 i=0; i<Plugins.Num(); i++)
+	{
+		if (Plugins.GetData()[i]->GetLoadedFrom() == EPluginLoadedFrom::Project)
+		{
+			Filter.PackagePaths.Add(*(TEXT("/") + Plugins.GetData()[i]->GetName()));
+		}
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	for (int32 i=0; i<Assets.Num(); i++)
+	{
+		class UStringTable *pStringTable = Cast<UStringTable>(Assets.GetData()[i].GetAsset());
+		if (!pStringTable)
+			continue;
+
+		const FName TableId = pStringTable->GetStringTableId();
+		const FString Namespace = pStringTable->GetStringTable()->GetNamespace();
+
+		//Summed per line so the hash doesn't depend on the order the table enumerates its lines in
+		const uint32 NamespaceHash = FCrc::StrCrc32(*Namespace);
+		uint32 &Hash = OutHashes.Add(TableId, 0);
+
+		pStringTable->GetStringTable()->EnumerateSourceStrings([&OutSources, &TableId, &Namespace, NamespaceHash, &Hash](const FString &InKey, const FString &InSourceString)
+		{
+			FDialogueLineDurationsSource &Source = OutSources.AddDefaulted_GetRef();
+			Source.TableId = TableId;
+			Source.Namespace = Namespace;
+			Source.Key = InKey;
+			Source.SourceString = InSourceString;
+
+			Hash += FCrc::StrCrc32(*InSourceString, FCrc::StrCrc32(*InKey, NamespaceHash));
+			return true;
+		});
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void BuildFromSources(class UDialogueLineDurations *InDurations, const TArray<FDialogueLineDurationsSource> &Sources)
+{
+	//Lines are looked up by name, keys that only differ in case are one line
+	TArray<int32> SourceIndices;
+	SourceIndices.Reserve(Sources.Num());
+
+	TSet<TPair<FName, FName>> Keys;
+	Keys.Reserve(Sources.Num());
+
+	InDurations->Lines.Reset(Sources.Num());
+
+	for (int32 i=0; i<Sources.Num(); i++)
+	{
+		const FDialogueLineDurationsSource &Source = Sources.GetData()[i];
+
+		const FName Key(*Source.Key);
+
+		bool bAlreadyInSet = false;
+		Keys.Add(TPair<FName, FName>(Source.TableId, Key), &bAlreadyInSet);
+		if (bAlreadyInSet)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Dialogue line durations: key \"%s\" in %s differs from another key only in case, they share one length"), *Source.Key, *Source.TableId.ToString());
+			continue;
+		}
+
+		FDialogueLineDurationsKey &Line = InDurations->Lines.AddDefaulted_GetRef();
+		Line.TableId = Source.TableId;
+		Line.Key = Key;
+		SourceIndices.Add(i);
+	}
+
+	TArray<FString> CultureNames = FTextLocalizationManager::Get().GetLocalizedCultureNames(ELocalizationLoadFlags::Game);
+	CultureNames.AddUnique(FTextLocalizationManager::Get().GetNativeCultureName(ELocalizedTextSourceCategory::Game));
+	CultureNames.Remove(FString());
+	CultureNames.Sort();
+
+	InDurations->Cultures.Reset(CultureNames.Num());
+
+	const TArray<FString> LocalizationPaths = FPaths::GetGameLocalizationPaths();
+
+	for (int32 i=0; i<CultureNames.Num(); i++)
+	{
+		const FString &Culture = CultureNames.GetData()[i];
+
+		//The same LocRes files a packaged game loads, without switching the editor language
+		FTextLocalizationResource Resource;
+		for (int32 j=0; j<LocalizationPaths.Num(); j++)
+		{
+			Resource.LoadFromDirectory(LocalizationPaths.GetData()[j] / Culture, 0);
+		}
+
+		FDialogueCultureLineDurations &Durations = InDurations->Cultures.AddDefaulted_GetRef();
+		Durations.Culture = Culture;
+		Durations.Letters.Reset(SourceIndices.Num());
+
+		for (int32 j=0; j<SourceIndices.Num(); j++)
+		{
+			const FDialogueLineDurationsSource &Source = Sources.GetData()[SourceIndices.GetData()[j]];
+
+			//Untranslated lines show the source string
+			const FTextLocalizationResource::FEntry *pEntry = Resource.Entries.Find(FTextId(FTextKey(*Source.Namespace), FTextKey(*Source.Key)));
+			const FString &Localized = pEntry ? *pEntry->LocalizedString : Source.SourceString;
+
+			const float flLetters = InDurations->CountLetters(Localized, Culture);
+			const uint16 iLetters = (uint16)FMath::Clamp(FMath::RoundToInt(flLetters * UDialogueLineDurations::LetterScale), 0, (int32)MAX_uint16);
+
+			Durations.Letters.Add(iLetters);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Dialogue line durations: %d lines in %d cultures"), InDurations->Lines.Num(), CultureNames.Num());
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueLineDurationsBuilder::Build(class UDialogueLineDurations *InDurations)
+{
+	TArray<FDialogueLineDurationsSource> Sources;
+	TMap<FName, uint32> Hashes;
+	GatherStringTables(Sources, Hashes);
+
+	BuildFromSources(InDurations, Sources);
+	InDurations->SourceTableHashes = MoveTemp(Hashes);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueLineDurationsBuilder::Verify(class UDialogueLineDurations *InDurations)
+{
+	TArray<FDialogueLineDurationsSource> Sources;
+	TMap<FName, uint32> Hashes;
+	GatherStringTables(Sources, Hashes);
+
+	TArray<FString> Changed;
+	for (const TPair<FName, uint32> &Pair : Hashes)
+	{
+		const uint32 *pHash = InDurations->SourceTableHashes.Find(Pair.Key);
+		if (!pHash || *pHash != Pair.Value)
+		{
+			Changed.Add(Pair.Key.ToString());
+		}
+	}
+
+	for (const TPair<FName, uint32> &Pair : InDurations->SourceTableHashes)
+	{
+		if (!Hashes.Contains(Pair.Key))
+		{
+			Changed.Add(Pair.Key.ToString());
+		}
+	}
+
+	if (Changed.Num() == 0)
+		return;
+
+	UE_LOG(LogTemp, Warning, TEXT("Dialogue line durations %s are out of date, rebuilt in memory. Save the asset to keep them. Changed string tables: %s"), *InDurations->GetPathName(), *FString::Join(Changed, TEXT(", ")));
+
+	BuildFromSources(InDurations, Sources);
+	InDurations->SourceTableHashes = MoveTemp(Hashes);
+	InDurations->MarkPackageDirty();
+}
@@ -0,0 +1,22 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//===========================================================================================================================
+// Fills UDialogueLineDurations from every string table of the project and its plugins, and the localization data of
+// every game culture. Bound to UDialogueLineDurations::OnRebuild, so it runs whenever the asset is saved or cooked.
+//===========================================================================================================================
+class FDialogueLineDurationsBuilder
+{
+public:
+
+	//
+	static void Build(class UDialogueLineDurations *InDurations);
+
+	//Bound to UDialogueLineDurations::OnVerify. Rebuilds and warns if a string table was added, removed or edited
+	static void Verify(class UDialogueLineDurations *InDurations);
+};
@@ -0,0 +1,124 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Commandlets/DialogueSimulateCommandlet.h"
+#include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueSimulator.h"
+#include "Engine/Blueprint.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+UDialogueSimulateCommandlet::UDialogueSimulateCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+int32 UDialogueSimulateCommandlet::Main(const FString &Params)
+{
+	FString Path = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Path="), Path);
+
+	FString Mode;
+	FParse::Value(*Params, TEXT("Mode="), Mode);
+
+	FString ReportFile;
+	FParse::Value(*Params, TEXT("Report="), ReportFile);
+
+	FDialogueSimulationSettings Settings;
+	Settings.Mode = Mode.Equals(TEXT("Random"), ESearchCase::IgnoreCase) ? EDialogueSimulationMode::RandomWalk : EDialogueSimulationMode::DepthFirst;
+	FParse::Value(*Params, TEXT("Runs="), Settings.MaxRuns);
+	FParse::Value(*Params, TEXT("Steps="), Settings.MaxSteps);
+	FParse::Value(*Params, TEXT("Seed="), Settings.RandomSeed);
+
+	int32 iShard = 0;
+	int32 iNumShards = 1;
+	FParse::Value(*Params, TEXT("Shard="), iShard);
+	FParse::Value(*Params, TEXT("NumShards="), iNumShards);
+
+	if (iNumShards <= 0 || iShard < 0 || iShard >= iNumShards)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid -Shard=%d -NumShards=%d, Shard must be from 0 to NumShards - 1"), iShard, iNumShards);
+		return 2;
+	}
+
+	IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(FName(*Path));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	//Same order in every shard
+	Assets.Sort([](const FAssetData &A, const FAssetData &B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+	FString Report;
+	int32 iScripts = 0;
+	int32 iDeadEnds = 0;
+	int32 iIndex = 0;
+
+	for (int32 i=0; i<Assets.Num(); i++)
+	{
+		const FAssetData &AssetData = Assets.GetData()[i];
+
+		FString ParentClassPath;
+		if (!AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassPath))
+			continue;
+
+		UClass *pParentClass = FindObject<UClass>(NULL, *FPackageName::ExportTextPathToObjectPath(ParentClassPath));
+		if (!pParentClass || !pParentClass->IsChildOf(UDialogue::StaticClass()))
+			continue;
+
+		if ((iIndex++ % iNumShards) != iShard)
+			continue;
+
+		UBlueprint *pBlueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		TSubclassOf<UDialogue> DialogueClass = pBlueprint ? pBlueprint->GeneratedClass.Get() : NULL;
+		if (!DialogueClass || DialogueClass->HasAnyClassFlags(CLASS_Abstract))
+			continue;
+
+		FDialogueSimulationReport ScriptReport;
+		FDialogueSimulator Simulator(DialogueClass, Settings);
+		if (!Simulator.Run(ScriptReport))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to simulate \"%s\""), *ScriptReport.Script);
+			continue;
+		}
+
+		iScripts++;
+		iDeadEnds += ScriptReport.NumDeadEnds;
+
+		FString Line = ScriptReport.ToString();
+		UE_LOG(LogTemp, Display, TEXT("%s"), *Line);
+		Report += Line;
+		Report += LINE_TERMINATOR;
+
+		//Loaded blueprints add up over hundreds of scripts
+		CollectGarbage(RF_NoFlags);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Simulated %d dialogue scripts, %d dead ends"), iScripts, iDeadEnds);
+
+	if (ReportFile.Len() > 0)
+	{
+		FFileHelper::SaveStringToFile(Report, *ReportFile, FFileHelper::EEncodingOptions::ForceUTF8);
+	}
+
+	return iDeadEnds > 0 ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DialogueSimulateCommandlet.generated.h"
+
+//===========================================================================================================================
+// Plays every dialogue script under a path with FDialogueSimulator and writes a report.
+//
+// -run=DialogueSimulate -Path=/Game/Dialogue -Mode=DepthFirst|Random -Runs=1000 -Seed=0 -Report=Saved/Dialogue.txt
+//
+// Scripts run one after another, the blueprint VM is game thread only. -Shard=N -NumShards=M plays every Mth script
+// starting from N, so several processes can split the project. Returns 1 if any script has a dead end, 2 if the
+// arguments are invalid.
+//===========================================================================================================================
+UCLASS()
+class UDialogueSimulateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UDialogueSimulateCommandlet();
+
+	virtual int32 Main(const FString &Params) override;
+};
@@ -17,8 +17,29 @@
 #include "GameplayTagContainer.h"
 #include "Dialogue/DialogueContext.h"
 
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Input/SButton.h"
+
 #define LOCTEXT_NAMESPACE "MissionLevelSelectorDetails"
 
+//===========================================================================================================================
+// Generators are only ever used for a FContextAndValue, so released ones can be pointed at the next struct
+//===========================================================================================================================
+static TArray<TSharedPtr<IPropertyRowGenerator>> FreeGenerators;
+static const int32 MaxFreeGenerators = 16;
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+struct FContextAndValueRoleEntry
+{
+	//Property memory is reused after blueprint compiles, so the name is checked too
+	FName Name;
+	EContextAndValueRole Role;
+};
+
+static TMap<const FProperty*, FContextAndValueRoleEntry> CachedRoles;
+
 //===========================================================================================================================
 // 
 //===========================================================================================================================
@@ -27,6 +48,103 @@ TSharedRef<IPropertyTypeCustomization> FContextAndValueDetails::MakeInstance()
 	return MakeShareable(new FContextAndValueDetails);
 }
 
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+FContextAndValueDetails::~FContextAndValueDetails()
+{
+	ReleaseGenerator(Generator);
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FContextAndValueDetails::ReleaseGenerator(TSharedPtr< class IPropertyRowGenerator >& InOutGenerator)
+{
+	if (!InOutGenerator.IsValid())
+		return;
+
+	if (FreeGenerators.Num() < MaxFreeGenerators)
+	{
+		//Owns its memory, the old struct might be gone by the time the generator refreshes
+		InOutGenerator->SetStructure(MakeShareable(new FStructOnScope(FContextAndValue::StaticStruct())));
+		FreeGenerators.Add(InOutGenerator);
+	}
+
+	InOutGenerator.Reset();
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FContextAndValueDetails::ClearSharedData()
+{
+	FreeGenerators.Empty();
+	CachedRoles.Empty();
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+EContextAndValueRole FContextAndValueDetails::GetRole(const class FProperty *InProperty)
+{
+	if (!InProperty)
+		return EContextAndValueRole::None;
+
+	FContextAndValueRoleEntry *pEntry = CachedRoles.Find(InProperty);
+	if (pEntry && pEntry->Name == InProperty->GetFName())
+		return pEntry->Role;
+
+	static const FName Name_ContextRole = TEXT("ContextRole");
+
+	EContextAndValueRole Role = EContextAndValueRole::None;
+
+	if (InProperty->HasMetaData(Name_ContextRole))
+	{
+		const FString &RoleName = InProperty->GetMetaData(Name_ContextRole);
+		if (RoleName == TEXT("Require"))
+		{
+			Role = EContextAndValueRole::Requirement;
+		}
+		else if (RoleName == TEXT("Disallow"))
+		{
+			Role = EContextAndValueRole::Disallowed;
+		}
+		else if (RoleName == TEXT("Change"))
+		{
+			Role = EContextAndValueRole::Change;
+		}
+	}
+	else
+	{
+		//Older properties without the meta
+		const FString PropertyName = InProperty->GetName();
+
+		if (PropertyName.Contains(TEXT("Require")) || PropertyName.Contains(TEXT("Include")))
+		{
+			Role = EContextAndValueRole::Requirement;
+		}
+		else if (PropertyName.Contains(TEXT("Disallow")) || PropertyName.Contains(TEXT("Exclude")))
+		{
+			Role = EContextAndValueRole::Disallowed;
+		}
+		else if (PropertyName.Contains(TEXT("Change")) ||
+				 PropertyName.Contains(TEXT("Add")) ||
+				 PropertyName.Contains(TEXT("Completion")) ||
+				 PropertyName.Contains(TEXT("Start")) ||
+				 PropertyName.Contains(TEXT("Set")))
+		{
+			Role = EContextAndValueRole::Change;
+		}
+	}
+
+	FContextAndValueRoleEntry Entry;
+	Entry.Name = InProperty->GetFName();
+	Entry.Role = Role;
+	CachedRoles.Add(InProperty, Entry);
+	return Role;
+}
+
 //===========================================================================================================================
 // 
 //===========================================================================================================================
@@ -39,6 +157,14 @@ void FContextAndValueDetails::CreateGeneratorForStruct(TSharedPtr< class IProper
 	StructPropertyHandle->GetValueData(Data);
 	TSharedPtr<FStructOnScope> StructOnScope = MakeShareable(new FStructOnScope(StructType, (uint8*)Data));
 
+	//Reuse a released generator
+	if (StructType == FContextAndValue::StaticStruct() && FreeGenerators.Num() > 0)
+	{
+		OutGenerator = FreeGenerators.Pop();
+		OutGenerator->SetStructure(StructOnScope);
+		return;
+	}
+
 	//Create property editor
 	FPropertyEditorModule& PropertyEditorModule = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
 
@@ -155,34 +281,19 @@ void FContextAndValueDetails::CustomizeHeader(TSharedRef<class IPropertyHandle>
 		return;
 	}
 
-	TSharedPtr<SWidget> TagWidget;
-	CreateStructCustom(Generator, FContextAndValue::StaticStruct(), StructPropertyHandle, TagPropertyHandle, TagWidget);
-	if (!TagWidget.IsValid())
-	{
-		return;
-	}
-
-	FString HintString;
-
-	FString PropertyName;
-	FArrayProperty *pArray = CastField<FArrayProperty>(PropertyHandle->GetProperty()->GetOwnerProperty());
+	FProperty *pOwner = PropertyHandle->GetProperty();
+	FArrayProperty *pArray = CastField<FArrayProperty>(pOwner->GetOwnerProperty());
 	if (pArray)
 	{
-		PropertyName = pArray->GetName();
-	}
-	else
-	{
-		PropertyName = PropertyHandle->GetProperty()->GetName();
+		pOwner = pArray;
 	}
 
-	bIsRequirement =	PropertyName.Contains(TEXT("Require")) || PropertyName.Contains(TEXT("Include"));
-	bIsDisallowed	=	PropertyName.Contains(TEXT("Disallow")) || PropertyName.Contains(TEXT("Exclude"));
-	bIsChange =			PropertyName.Contains(TEXT("Change")) ||
-						PropertyName.Contains(TEXT("Add")) ||
-						PropertyName.Contains(TEXT("Completion")) ||
-						PropertyName.Contains(TEXT("Start")) ||
-						PropertyName.Contains(TEXT("Set"));
+	const EContextAndValueRole Role = GetRole(pOwner);
+	bIsRequirement = Role == EContextAndValueRole::Requirement;
+	bIsDisallowed = Role == EContextAndValueRole::Disallowed;
+	bIsChange = Role == EContextAndValueRole::Change;
 
+	FString HintString;
 
 	if (bIsRequirement)
 	{
@@ -219,7 +330,18 @@ void FContextAndValueDetails::CustomizeHeader(TSharedRef<class IPropertyHandle>
 			.VAlign(VAlign_Center)
 			.AutoWidth()
 			[
-				TagWidget.ToSharedRef()
+				SAssignNew(TagBox, SBox)
+				[
+					SNew(SButton)
+					.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+					.OnHovered(this, &FContextAndValueDetails::RequestTagWidget)
+					.OnClicked_Lambda([this]() { RequestTagWidget(); return FReply::Handled(); })
+					[
+						SNew(STextBlock)
+						.Font(IDetailLayoutBuilder::GetDetailFont())
+						.Text(this, &FContextAndValueDetails::GetTagText)
+					]
+				]
 			]
 
 			+ SHorizontalBox::Slot()
@@ -268,6 +390,58 @@ void FContextAndValueDetails::CustomizeHeader(TSharedRef<class IPropertyHandle>
 	];	
 }
 
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+void FContextAndValueDetails::RequestTagWidget()
+{
+	if (bTagWidgetRequested || Generator.IsValid() || !TagBox.IsValid())
+		return;
+
+	bTagWidgetRequested = true;
+	TagBox->RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &FContextAndValueDetails::CreateTagWidget));
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+EActiveTimerReturnType FContextAndValueDetails::CreateTagWidget(double InCurrentTime, float InDeltaTime)
+{
+	bTagWidgetRequested = false;
+
+	if (Generator.IsValid() || !TagBox.IsValid() || !PropertyHandle.IsValid())
+		return EActiveTimerReturnType::Stop;
+
+	TSharedPtr<SWidget> TagWidget;
+	CreateStructCustom(Generator, FContextAndValue::StaticStruct(), PropertyHandle, TagPropertyHandle, TagWidget);
+	if (TagWidget.IsValid())
+	{
+		TagBox->SetContent(TagWidget.ToSharedRef());
+	}
+
+	return EActiveTimerReturnType::Stop;
+}
+
+//===========================================================================================================================
+// 
+//===========================================================================================================================
+FText FContextAndValueDetails::GetTagText() const
+{
+	if (!TagPropertyHandle.IsValid())
+		return FText::GetEmpty();
+
+	void* pValue = NULL;
+	TagPropertyHandle->GetValueData(pValue);
+	if (pValue == NULL)
+		return FText::GetEmpty();
+
+	const FGameplayTag &Tag = *((FGameplayTag*)pValue);
+	if (!Tag.IsValid())
+		return LOCTEXT("NoContextTag", "None");
+
+	return FText::FromName(Tag.GetTagName());
+}
+
 //===========================================================================================================================
 // 
 //===========================================================================================================================
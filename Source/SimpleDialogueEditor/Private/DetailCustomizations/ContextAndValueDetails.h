@@ -14,6 +14,16 @@
 
 class IPropertyHandle;
 
+//=================================================================
+// How the owning property uses the context, from ContextRole meta
+//=================================================================
+enum class EContextAndValueRole : uint8
+{
+	None,
+	Requirement,
+	Disallowed,
+	Change,
+};
 
 //=================================================================
 // 
@@ -24,8 +34,14 @@ public:
 	/** Makes a new instance of this detail layout class for a specific detail view requesting it */
 	static TSharedRef<IPropertyTypeCustomization> MakeInstance();
 
+	//Gives the generator back to the shared pool
+	virtual ~FContextAndValueDetails();
+
 	SIMPLEDIALOGUEEDITOR_API static void CreateGeneratorForStruct(TSharedPtr< class IPropertyRowGenerator >& OutGenerator, class UScriptStruct* StructType, TSharedPtr<class IPropertyHandle> StructPropertyHandle);
 	SIMPLEDIALOGUEEDITOR_API static void GetWidgetForProperty(TSharedPtr< class IPropertyRowGenerator >& OutGenerator, TSharedPtr<class IPropertyHandle> ThePropertyHandle, TSharedPtr<SWidget>& OutWidget);
+	SIMPLEDIALOGUEEDITOR_API static void ReleaseGenerator(TSharedPtr< class IPropertyRowGenerator >& InOutGenerator);
+	//Pooled generators and cached roles, on module shutdown and when objects are replaced or reinstanced
+	static void ClearSharedData();
 	SIMPLEDIALOGUEEDITOR_API static void CreateStructCustom(TSharedPtr< class IPropertyRowGenerator >& OutGenerator, class UScriptStruct* StructType, TSharedPtr<class IPropertyHandle> StructPropertyHandle, TSharedPtr<class IPropertyHandle> PropertyHandle, TSharedPtr<SWidget>& OutWidget);
 	
 	/** IPropertyTypeCustomization interface */
@@ -46,6 +62,9 @@ public:
 
 	FSlateColor GetBackgroundColor() const;
 
+	//Cached per owning property, the same array can have hundreds of elements
+	static EContextAndValueRole GetRole(const class FProperty *InProperty);
+
 	//
 	bool bIsRequirement;
 	bool bIsDisallowed;
@@ -53,6 +72,14 @@ public:
 
 private:
 
+	//The tag widget needs a row generator, so it is only made when the placeholder is hovered or clicked.
+	//The placeholder is replaced on the next tick, not inside its own hover or click callback
+	void RequestTagWidget();
+	EActiveTimerReturnType CreateTagWidget(double InCurrentTime, float InDeltaTime);
+
+	//
+	FText GetTagText() const;
+
 	TSharedPtr<IPropertyHandle> PropertyHandle;
 	TSharedPtr<IPropertyHandle> TagPropertyHandle;
 	TSharedPtr<IPropertyHandle> ValuePropertyHandle;
@@ -64,4 +91,8 @@ private:
 	//
 	/** Row generator applied on detailed object */
 	TSharedPtr< class IPropertyRowGenerator > Generator;
+
+	//Holds the placeholder until CreateTagWidget
+	TSharedPtr<class SBox> TagBox;
+	bool bTagWidgetRequested = false;
 };
@@ -0,0 +1,180 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Inspector/DialogueLineDiff.h"
+#include "Algo/Reverse.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueLineDiffLines
+{
+	const FString *Lines;
+	const uint32 *Hashes;
+
+	FORCEINLINE bool Equals(int32 Index, const FDialogueLineDiffLines &Other, int32 OtherIndex) const
+	{
+		return Hashes[Index] == Other.Hashes[OtherIndex] && Lines[Index].Equals(Other.Lines[OtherIndex], ESearchCase::CaseSensitive);
+	}
+};
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void HashLines(const TArray<FString> &Lines, TArray<uint32> &OutHashes)
+{
+	OutHashes.SetNumUninitialized(Lines.Num());
+	for (int32 i=0; i<Lines.Num(); i++)
+	{
+		OutHashes.GetData()[i] = FCrc::StrCrc32(*Lines.GetData()[i]);
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+bool FDialogueLineDiff::Diff(const TArray<FString> &OldLines, const TArray<FString> &NewLines, TArray<FDialogueLineEdit> &OutEdits, int32 MaxEditDistance)
+{
+	OutEdits.Reset(FMath::Max(OldLines.Num(), NewLines.Num()));
+
+	TArray<uint32> OldHashes;
+	TArray<uint32> NewHashes;
+	HashLines(OldLines, OldHashes);
+	HashLines(NewLines, NewHashes);
+
+	FDialogueLineDiffLines Old = { OldLines.GetData(), OldHashes.GetData() };
+	FDialogueLineDiffLines New = { NewLines.GetData(), NewHashes.GetData() };
+
+	//Strip common prefix and suffix
+	int32 iPrefix = 0;
+	while (iPrefix < OldLines.Num() && iPrefix < NewLines.Num() && Old.Equals(iPrefix, New, iPrefix))
+	{
+		iPrefix++;
+	}
+
+	int32 iSuffix = 0;
+	while (iSuffix < OldLines.Num() - iPrefix && iSuffix < NewLines.Num() - iPrefix && Old.Equals(OldLines.Num() - 1 - iSuffix, New, NewLines.Num() - 1 - iSuffix))
+	{
+		iSuffix++;
+	}
+
+	for (int32 i=0; i<iPrefix; i++)
+	{
+		OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Keep, i, i));
+	}
+
+	const int32 N = OldLines.Num() - iPrefix - iSuffix;
+	const int32 M = NewLines.Num() - iPrefix - iSuffix;
+	const int32 Max = FMath::Min(N + M, MaxEditDistance);
+
+	bool bSuccess = false;
+
+	//V[k] is the furthest x reached on diagonal k. Trace keeps V from the start of every d for backtracking, limited to [-d-1, d+1]
+	TArray<int32> V;
+	V.SetNumZeroed(2 * (N + M) + 3);
+	const int32 Offset = N + M + 1;
+
+	TArray<TArray<int32>> Trace;
+
+	int32 iFinalD = INDEX_NONE;
+	for (int32 d=0; d<=Max && iFinalD == INDEX_NONE; d++)
+	{
+		TArray<int32> &Snapshot = Trace.AddDefaulted_GetRef();
+		Snapshot.SetNumUninitialized(2 * d + 3);
+		FMemory::Memcpy(Snapshot.GetData(), V.GetData() + Offset - d - 1, Snapshot.Num() * sizeof(int32));
+
+		for (int32 k=-d; k<=d; k+=2)
+		{
+			int32 x;
+			if (k == -d || (k != d && V[Offset + k - 1] < V[Offset + k + 1]))
+			{
+				x = V[Offset + k + 1];
+			}
+			else
+			{
+				x = V[Offset + k - 1] + 1;
+			}
+
+			int32 y = x - k;
+			while (x < N && y < M && Old.Equals(iPrefix + x, New, iPrefix + y))
+			{
+				x++;
+				y++;
+			}
+
+			V[Offset + k] = x;
+
+			if (x >= N && y >= M)
+			{
+				iFinalD = d;
+				break;
+			}
+		}
+	}
+
+	int32 iMiddleStart = OutEdits.Num();
+
+	if (iFinalD != INDEX_NONE)
+	{
+		bSuccess = true;
+
+		//Backtrack, edits come out reversed
+		int32 x = N;
+		int32 y = M;
+		for (int32 d=iFinalD; d>=0; d--)
+		{
+			const TArray<int32> &Snapshot = Trace.GetData()[d];
+			auto GetV = [&Snapshot, d](int32 k) { return Snapshot.GetData()[k + d + 1]; };
+
+			int32 k = x - y;
+			int32 iPrevK = (k == -d || (k != d && GetV(k - 1) < GetV(k + 1))) ? k + 1 : k - 1;
+			int32 iPrevX = GetV(iPrevK);
+			int32 iPrevY = iPrevX - iPrevK;
+
+			while (x > iPrevX && y > iPrevY)
+			{
+				OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Keep, iPrefix + x - 1, iPrefix + y - 1));
+				x--;
+				y--;
+			}
+
+			if (d > 0)
+			{
+				if (x == iPrevX)
+				{
+					OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Insert, INDEX_NONE, iPrefix + y - 1));
+				}
+				else
+				{
+					OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Delete, iPrefix + x - 1, INDEX_NONE));
+				}
+			}
+
+			x = iPrevX;
+			y = iPrevY;
+		}
+
+		Algo::Reverse(OutEdits.GetData() + iMiddleStart, OutEdits.Num() - iMiddleStart);
+	}
+	else
+	{
+		//Too different, replace the whole middle part
+		for (int32 i=0; i<N; i++)
+		{
+			OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Delete, iPrefix + i, INDEX_NONE));
+		}
+
+		for (int32 i=0; i<M; i++)
+		{
+			OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Insert, INDEX_NONE, iPrefix + i));
+		}
+	}
+
+	for (int32 i=0; i<iSuffix; i++)
+	{
+		OutEdits.Add(FDialogueLineEdit(EDialogueLineEditType::Keep, OldLines.Num() - iSuffix + i, NewLines.Num() - iSuffix + i));
+	}
+
+	return bSuccess;
+}
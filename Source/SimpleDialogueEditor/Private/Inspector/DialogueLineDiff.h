@@ -0,0 +1,41 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+enum class EDialogueLineEditType : uint8
+{
+	Keep,
+	Insert,
+	Delete,
+};
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueLineEdit
+{
+	EDialogueLineEditType Type;
+	int32 OldIndex;
+	int32 NewIndex;
+
+	FDialogueLineEdit(EDialogueLineEditType InType, int32 InOldIndex, int32 InNewIndex) : Type(InType), OldIndex(InOldIndex), NewIndex(InNewIndex) { }
+};
+
+//===========================================================================================================================
+// Myers diff between two lists of lines. Common prefix and suffix are stripped first so a single edited line
+// costs O(N). Edits come out in order, Keep entries have both indices, Insert only NewIndex, Delete only OldIndex.
+//===========================================================================================================================
+class FDialogueLineDiff
+{
+public:
+
+	//Returns false if the lists differ by more than MaxEditDistance lines, OutEdits is then filled with a plain delete + insert of the differing middle part
+	static bool Diff(const TArray<FString> &OldLines, const TArray<FString> &NewLines, TArray<FDialogueLineEdit> &OutEdits, int32 MaxEditDistance = 1024);
+};
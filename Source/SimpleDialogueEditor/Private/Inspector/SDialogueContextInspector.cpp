@@ -0,0 +1,472 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Inspector/SDialogueContextInspector.h"
+#include "Dialogue/DialogueManager.h"
+#include "Editor.h"
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "DetailLayoutBuilder.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
+
+#define LOCTEXT_NAMESPACE "DialogueContextInspector"
+
+const FName SDialogueContextInspector::TabName = TEXT("DialogueContextInspector");
+
+//Oldest half is dropped when the history gets this long
+static const int32 MaxHistory = 4000;
+
+//Seconds a changed value stays highlighted
+static const double HighlightTime = 2.0;
+
+static const FName Column_Actor = TEXT("Actor");
+static const FName Column_Tag = TEXT("Tag");
+static const FName Column_Value = TEXT("Value");
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+class SDialogueContextInspectorRow : public SMultiColumnTableRow<FDialogueContextInspectorRowPtr>
+{
+public:
+
+	SLATE_BEGIN_ARGS(SDialogueContextInspectorRow) {}
+	SLATE_END_ARGS()
+
+	//
+	void Construct(const FArguments &InArgs, const TSharedRef<STableViewBase> &OwnerTable, FDialogueContextInspectorRowPtr InItem, SDialogueContextInspector *InInspector)
+	{
+		Item = InItem;
+		Inspector = InInspector;
+		SMultiColumnTableRow<FDialogueContextInspectorRowPtr>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	//
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName &ColumnName) override
+	{
+		if (ColumnName == Column_Actor)
+		{
+			return SNew(STextBlock).Font(IDetailLayoutBuilder::GetDetailFont()).Text(Item->ActorText);
+		}
+
+		if (ColumnName == Column_Tag)
+		{
+			return SNew(STextBlock).Font(IDetailLayoutBuilder::GetDetailFont()).Text(Item->TagText);
+		}
+
+		FDialogueContextInspectorRowPtr Row = Item;
+		return SNew(STextBlock)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+			.Text_Lambda([Row]() { return Row->bRemoved ? LOCTEXT("Removed", "removed") : FText::AsNumber(Row->Value); })
+			.ColorAndOpacity_Lambda([this, Row]() { return Inspector->GetRowColor(Row); });
+	}
+
+private:
+
+	FDialogueContextInspectorRowPtr Item;
+	SDialogueContextInspector *Inspector = NULL;
+};
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+TSharedRef<SDockTab> SDialogueContextInspector::SpawnTab(const FSpawnTabArgs &Args)
+{
+	return
+		SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		.Label(LOCTEXT("TabTitle", "Dialogue Context"))
+		[
+			SNew(SDialogueContextInspector)
+		];
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::Construct(const FArguments &InArgs)
+{
+	RowListView = SNew(SListView<FDialogueContextInspectorRowPtr>)
+		.ListItemsSource(&FilteredRows)
+		.OnGenerateRow(this, &SDialogueContextInspector::OnGenerateRow)
+		.SelectionMode(ESelectionMode::None)
+		.HeaderRow
+		(
+			SNew(SHeaderRow)
+			+ SHeaderRow::Column(Column_Actor).DefaultLabel(LOCTEXT("ActorColumn", "Actor")).FillWidth(0.3f)
+			+ SHeaderRow::Column(Column_Tag).DefaultLabel(LOCTEXT("TagColumn", "Context")).FillWidth(0.5f)
+			+ SHeaderRow::Column(Column_Value).DefaultLabel(LOCTEXT("ValueColumn", "Value")).FillWidth(0.2f)
+		);
+
+	HistoryListView = SNew(SListView<FDialogueContextHistoryItemPtr>)
+		.ListItemsSource(&History)
+		.OnGenerateRow(this, &SDialogueContextInspector::OnGenerateHistoryRow)
+		.SelectionMode(ESelectionMode::None);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(SSearchBox)
+			.HintText(LOCTEXT("Filter", "Context tag subtree or text..."))
+			.OnTextChanged(this, &SDialogueContextInspector::OnFilterTextChanged)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(STextBlock)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+			.Text(this, &SDialogueContextInspector::GetStatusText)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			+ SSplitter::Slot()
+			.Value(0.7f)
+			[
+				RowListView.ToSharedRef()
+			]
+
+			+ SSplitter::Slot()
+			.Value(0.3f)
+			[
+				HistoryListView.ToSharedRef()
+			]
+		]
+	];
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+class UDialogueManager *SDialogueContextInspector::FindManager()
+{
+	UWorld *pWorld = GEditor ? GEditor->PlayWorld : NULL;
+	if (!pWorld)
+		return NULL;
+
+	for (TObjectIterator<UDialogueManager> It; It; ++It)
+	{
+		if (It->GetWorld() == pWorld && !It->IsTemplate() && IsValid(*It))
+			return *It;
+	}
+
+	return NULL;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::Tick(const FGeometry &AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	class UDialogueManager *pManager = Manager.Get();
+	if (!pManager)
+	{
+		pManager = FindManager();
+		if (!pManager)
+		{
+			if (Rows.Num() > 0 || Manager.IsStale())
+			{
+				Manager.Reset();
+				TakeSnapshot(NULL);
+			}
+			return;
+		}
+
+		Manager = pManager;
+		TakeSnapshot(pManager);
+		return;
+	}
+
+	const FDialogueContextFeed &Feed = pManager->GetContextFeed();
+	if (Feed.GetHead() == Cursor)
+		return;
+
+	NewChanges.Reset();
+	if (!Feed.Read(Cursor, NewChanges))
+	{
+		//Fell behind, the lost changes can't be applied one by one
+		TakeSnapshot(pManager);
+		return;
+	}
+
+	const int32 iFilteredRows = FilteredRows.Num();
+
+	for (int32 i=0; i<NewChanges.Num(); i++)
+	{
+		ApplyChange(NewChanges.GetData()[i]);
+		AddHistory(NewChanges.GetData()[i]);
+	}
+
+	NumChanges += NewChanges.Num();
+
+	if (History.Num() > MaxHistory)
+	{
+		History.RemoveAt(0, History.Num() - MaxHistory / 2);
+	}
+
+	if (FilteredRows.Num() != iFilteredRows)
+	{
+		RowListView->RequestListRefresh();
+	}
+
+	HistoryListView->RequestListRefresh();
+	HistoryListView->ScrollToBottom();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::TakeSnapshot(class UDialogueManager *InManager)
+{
+	Rows.Reset();
+	RowMap.Reset();
+	NumSnapshots++;
+
+	if (InManager)
+	{
+		Cursor = InManager->GetContextFeed().GetHead();
+
+		for (const TPair<FGameplayTag, int32> &Pair : InManager->GetGlobalContext())
+		{
+			FindOrAddRow(Pair.Key, FGameplayTag())->Value = Pair.Value;
+		}
+
+		for (const TPair<FGameplayTag, FSavedContextMap> &Actor : InManager->GetActorContext())
+		{
+			for (const TPair<FGameplayTag, int32> &Pair : Actor.Value.Values)
+			{
+				FindOrAddRow(Pair.Key, Actor.Key)->Value = Pair.Value;
+			}
+		}
+	}
+
+	UpdateFilteredRows();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FDialogueContextInspectorRowPtr SDialogueContextInspector::FindOrAddRow(const FGameplayTag &InTag, const FGameplayTag &InActorTag)
+{
+	FDialogueContextInspectorRowPtr &Row = RowMap.FindOrAdd(TPair<FGameplayTag, FGameplayTag>(InTag, InActorTag));
+	if (!Row.IsValid())
+	{
+		Row = MakeShareable(new FDialogueContextInspectorRow);
+		Row->Tag = InTag;
+		Row->ActorTag = InActorTag;
+		Row->TagText = FText::FromName(InTag.GetTagName());
+		Row->ActorText = InActorTag.IsValid() ? FText::FromName(InActorTag.GetTagName()) : LOCTEXT("Global", "Global");
+		Rows.Add(Row);
+	}
+
+	return Row;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::ApplyChange(const FDialogueContextChange &InChange)
+{
+	if (InChange.Type == EDialogueContextChange::Clear)
+	{
+		//Rare, every row of the actor has to be found
+		for (int32 i=0; i<Rows.Num(); i++)
+		{
+			FDialogueContextInspectorRow &Row = *Rows.GetData()[i];
+			if (Row.ActorTag == InChange.ActorTag && !Row.bRemoved)
+			{
+				Row.bRemoved = true;
+				Row.ChangeTime = InChange.Time;
+			}
+		}
+		return;
+	}
+
+	const bool bExists = RowMap.Contains(TPair<FGameplayTag, FGameplayTag>(InChange.Tag, InChange.ActorTag));
+
+	FDialogueContextInspectorRowPtr Row = FindOrAddRow(InChange.Tag, InChange.ActorTag);
+	Row->Value = InChange.NewValue;
+	Row->bRemoved = InChange.Type == EDialogueContextChange::Remove;
+	Row->ChangeTime = InChange.Time;
+
+	if (!bExists && PassesFilter(*Row))
+	{
+		FilteredRows.Add(Row);
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::AddHistory(const FDialogueContextChange &InChange)
+{
+	FString ActorName = InChange.ActorTag.IsValid() ? InChange.ActorTag.ToString() : TEXT("Global");
+
+	FDialogueContextHistoryItemPtr Item = MakeShareable(new FDialogueContextHistoryItem);
+	Item->Change = InChange;
+
+	switch (InChange.Type)
+	{
+	case EDialogueContextChange::Set:
+		Item->Text = FText::FromString(FString::Printf(TEXT("%.3f  %s  %s  %d -> %d"), InChange.Time - GStartTime, *ActorName, *InChange.Tag.ToString(), InChange.OldValue, InChange.NewValue));
+		break;
+
+	case EDialogueContextChange::Remove:
+		Item->Text = FText::FromString(FString::Printf(TEXT("%.3f  %s  %s  removed (%d)"), InChange.Time - GStartTime, *ActorName, *InChange.Tag.ToString(), InChange.OldValue));
+		break;
+
+	case EDialogueContextChange::Clear:
+		Item->Text = FText::FromString(FString::Printf(TEXT("%.3f  %s  all context removed"), InChange.Time - GStartTime, *ActorName));
+		break;
+	}
+
+	History.Add(Item);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+bool SDialogueContextInspector::PassesFilter(const FDialogueContextInspectorRow &InRow) const
+{
+	if (FilterTag.IsValid())
+		return InRow.Tag.MatchesTag(FilterTag) || InRow.ActorTag.MatchesTag(FilterTag);
+
+	if (FilterString.Len() > 0)
+		return InRow.TagText.ToString().Contains(FilterString) || InRow.ActorText.ToString().Contains(FilterString);
+
+	return true;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::UpdateFilteredRows()
+{
+	FilteredRows.Reset(Rows.Num());
+
+	for (int32 i=0; i<Rows.Num(); i++)
+	{
+		if (PassesFilter(*Rows.GetData()[i]))
+		{
+			FilteredRows.Add(Rows.GetData()[i]);
+		}
+	}
+
+	FilteredRows.Sort([](const FDialogueContextInspectorRowPtr &A, const FDialogueContextInspectorRowPtr &B)
+	{
+		if (A->ActorTag != B->ActorTag)
+			return A->ActorTag.GetTagName().Compare(B->ActorTag.GetTagName()) < 0;
+
+		return A->Tag.GetTagName().Compare(B->Tag.GetTagName()) < 0;
+	});
+
+	if (RowListView.IsValid())
+	{
+		RowListView->RequestListRefresh();
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialogueContextInspector::OnFilterTextChanged(const FText &InFilterText)
+{
+	FilterString = InFilterText.ToString();
+	FilterTag = FGameplayTag::RequestGameplayTag(FName(*FilterString), false);
+	UpdateFilteredRows();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FSlateColor SDialogueContextInspector::GetRowColor(FDialogueContextInspectorRowPtr InRow) const
+{
+	static const FLinearColor ChangedColor = FLinearColor(1.0f, 0.8f, 0.0f);
+	static const FLinearColor RemovedColor = FLinearColor(0.4f, 0.4f, 0.4f);
+
+	if (InRow->bRemoved)
+		return RemovedColor;
+
+	if (InRow->ChangeTime <= 0.0)
+		return FSlateColor::UseForeground();
+
+	const double flAge = FPlatformTime::Seconds() - InRow->ChangeTime;
+	if (flAge >= HighlightTime)
+		return FSlateColor::UseForeground();
+
+	return FMath::Lerp(ChangedColor, FLinearColor::White, (float)(flAge / HighlightTime));
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FText SDialogueContextInspector::GetStatusText() const
+{
+	class UDialogueManager *pManager = Manager.Get();
+	if (!pManager)
+		return LOCTEXT("NoManager", "No dialogue manager in play in editor");
+
+	return FText::Format(LOCTEXT("Status", "{0}: {1} values, {2} shown, {3} changes, {4} full copies"),
+		FText::FromString(pManager->GetOwner() ? pManager->GetOwner()->GetName() : pManager->GetName()),
+		FText::AsNumber(Rows.Num()),
+		FText::AsNumber(FilteredRows.Num()),
+		FText::AsNumber(NumChanges),
+		FText::AsNumber(NumSnapshots));
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+TSharedRef<ITableRow> SDialogueContextInspector::OnGenerateRow(FDialogueContextInspectorRowPtr InItem, const TSharedRef<STableViewBase> &OwnerTable)
+{
+	return SNew(SDialogueContextInspectorRow, OwnerTable, InItem, this);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+TSharedRef<ITableRow> SDialogueContextInspector::OnGenerateHistoryRow(FDialogueContextHistoryItemPtr InItem, const TSharedRef<STableViewBase> &OwnerTable)
+{
+	return
+	SNew(STableRow<FDialogueContextHistoryItemPtr>, OwnerTable)
+	[
+		SNew(STextBlock)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+		.Text(InItem->Text)
+	];
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void OpenDialogueContextInspector(const TArray<FString> &Args)
+{
+	FGlobalTabmanager::Get()->TryInvokeTab(SDialogueContextInspector::TabName);
+}
+
+static FAutoConsoleCommand OpenDialogueContextInspectorCommand(
+	TEXT("SimpleDialogue.ContextInspector"),
+	TEXT("Opens the live dialogue context inspector"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&OpenDialogueContextInspector));
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,119 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "GameplayTagContainer.h"
+#include "Dialogue/DialogueContextFeed.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueContextInspectorRow
+{
+	FGameplayTag Tag;
+	FGameplayTag ActorTag;
+	int32 Value = 0;
+	bool bRemoved = false;
+
+	//FPlatformTime::Seconds of the last change, 0 if it was there when the inspector attached
+	double ChangeTime = 0.0;
+
+	FText TagText;
+	FText ActorText;
+};
+
+typedef TSharedPtr<FDialogueContextInspectorRow> FDialogueContextInspectorRowPtr;
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueContextHistoryItem
+{
+	FDialogueContextChange Change;
+	FText Text;
+};
+
+typedef TSharedPtr<FDialogueContextHistoryItem> FDialogueContextHistoryItemPtr;
+
+//===========================================================================================================================
+// Global and actor context of the dialogue manager in the play in editor world. Takes one full copy when it attaches
+// and after that only reads UDialogueManager::GetContextFeed, so the cost per frame is the number of changes and not
+// the number of context values.
+//===========================================================================================================================
+class SDialogueContextInspector : public SCompoundWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SDialogueContextInspector) {}
+	SLATE_END_ARGS()
+
+	//
+	void Construct(const FArguments &InArgs);
+
+	//
+	virtual void Tick(const FGeometry &AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	//
+	static const FName TabName;
+
+	//
+	static TSharedRef<class SDockTab> SpawnTab(const class FSpawnTabArgs &Args);
+
+	//
+	FSlateColor GetRowColor(FDialogueContextInspectorRowPtr InRow) const;
+
+private:
+
+	//
+	static class UDialogueManager *FindManager();
+
+	//
+	void TakeSnapshot(class UDialogueManager *InManager);
+
+	//
+	void ApplyChange(const FDialogueContextChange &InChange);
+
+	//
+	FDialogueContextInspectorRowPtr FindOrAddRow(const FGameplayTag &InTag, const FGameplayTag &InActorTag);
+
+	//
+	void AddHistory(const FDialogueContextChange &InChange);
+
+	//
+	bool PassesFilter(const FDialogueContextInspectorRow &InRow) const;
+	void UpdateFilteredRows();
+	void OnFilterTextChanged(const FText &InFilterText);
+
+	//
+	TSharedRef<class ITableRow> OnGenerateRow(FDialogueContextInspectorRowPtr InItem, const TSharedRef<class STableViewBase> &OwnerTable);
+	TSharedRef<class ITableRow> OnGenerateHistoryRow(FDialogueContextHistoryItemPtr InItem, const TSharedRef<class STableViewBase> &OwnerTable);
+
+	//
+	FText GetStatusText() const;
+
+	TWeakObjectPtr<class UDialogueManager> Manager;
+	uint64 Cursor = 0;
+
+	TArray<FDialogueContextInspectorRowPtr> Rows;
+	TMap<TPair<FGameplayTag, FGameplayTag>, FDialogueContextInspectorRowPtr> RowMap;
+	TArray<FDialogueContextInspectorRowPtr> FilteredRows;
+	TSharedPtr<SListView<FDialogueContextInspectorRowPtr>> RowListView;
+
+	TArray<FDialogueContextHistoryItemPtr> History;
+	TSharedPtr<SListView<FDialogueContextHistoryItemPtr>> HistoryListView;
+
+	//Tag subtree if the filter is a valid tag, otherwise plain text
+	FGameplayTag FilterTag;
+	FString FilterString;
+
+	int32 NumSnapshots = 0;
+	int32 NumChanges = 0;
+
+	//Scratch for feed reads
+	TArray<FDialogueContextChange> NewChanges;
+};
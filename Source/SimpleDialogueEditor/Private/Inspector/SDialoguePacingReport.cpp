@@ -0,0 +1,409 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Inspector/SDialoguePacingReport.h"
+#include "Dialogue/DialogueManager.h"
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "DetailLayoutBuilder.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+
+#define LOCTEXT_NAMESPACE "DialoguePacingReport"
+
+const FName SDialoguePacingReport::TabName = TEXT("DialoguePacingReport");
+
+//Shortest lines are skipped this fast by one in ten players
+static const float MinimumTextTimePercentile = 0.1f;
+
+static const FName Column_Script = TEXT("Script");
+static const FName Column_Lines = TEXT("Lines");
+static const FName Column_Early = TEXT("Early");
+static const FName Column_Ratio = TEXT("Ratio");
+static const FName Column_TimePerLetter = TEXT("TimePerLetter");
+static const FName Column_AdditionalTextTime = TEXT("AdditionalTextTime");
+static const FName Column_MinimumTextTime = TEXT("MinimumTextTime");
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static FText FormatSuggestion(const TOptional<float> &InSuggested, float InCurrent)
+{
+	if (!InSuggested.IsSet())
+		return LOCTEXT("NoSuggestion", "-");
+
+	return FText::FromString(FString::Printf(TEXT("%.3f (%+.3f)"), InSuggested.GetValue(), InSuggested.GetValue() - InCurrent));
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+class SDialoguePacingReportRow : public SMultiColumnTableRow<FDialoguePacingReportRowPtr>
+{
+public:
+
+	SLATE_BEGIN_ARGS(SDialoguePacingReportRow) {}
+	SLATE_END_ARGS()
+
+	//
+	void Construct(const FArguments &InArgs, const TSharedRef<STableViewBase> &OwnerTable, FDialoguePacingReportRowPtr InItem)
+	{
+		Item = InItem;
+		SMultiColumnTableRow<FDialoguePacingReportRowPtr>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	//
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName &ColumnName) override
+	{
+		return SNew(STextBlock).Font(IDetailLayoutBuilder::GetDetailFont()).Text(GetColumnText(ColumnName));
+	}
+
+private:
+
+	//
+	FText GetColumnText(const FName &ColumnName) const
+	{
+		const FDialoguePacingHistogram &Histogram = Item->Histogram;
+		const UDialogueManager *pDefaults = GetDefault<UDialogueManager>();
+
+		if (ColumnName == Column_Script)
+			return Item->Key.IsNone() ? Item->ScriptText : Item->KeyText;
+
+		if (ColumnName == Column_Lines)
+			return FText::AsNumber(Histogram.NumLines);
+
+		if (ColumnName == Column_Early)
+		{
+			const uint32 iTimed = Histogram.NumLines - Histogram.NumUntimed;
+			return iTimed > 0 ? FText::AsPercent((float)Histogram.NumSkippedEarly / iTimed) : LOCTEXT("NoSuggestion", "-");
+		}
+
+		if (ColumnName == Column_Ratio)
+		{
+			//Text histogram of shown time / Box_Delay, one character per bucket
+			static const TCHAR Levels[] = TEXT(" .:-=+*#");
+			uint32 iMax = 0;
+			for (int32 i=0; i<FDialoguePacingHistogram::NumRatioBuckets; i++)
+			{
+				iMax = FMath::Max(iMax, Histogram.RatioBuckets[i]);
+			}
+
+			FString Bars;
+			for (int32 i=0; i<FDialoguePacingHistogram::NumRatioBuckets; i++)
+			{
+				Bars += iMax > 0 ? Levels[(Histogram.RatioBuckets[i] * 7 + iMax - 1) / iMax] : TEXT(' ');
+			}
+			return FText::FromString(FString::Printf(TEXT("[%s]"), *Bars));
+		}
+
+		if (ColumnName == Column_TimePerLetter)
+			return FormatSuggestion(Item->TimePerLetter, pDefaults->GetTimePerLetter());
+
+		if (ColumnName == Column_AdditionalTextTime)
+			return FormatSuggestion(Item->AdditionalTextTime, pDefaults->GetAdditionalTextTime());
+
+		return FormatSuggestion(Item->MinimumTextTime, pDefaults->GetMinimumTextTime());
+	}
+
+	FDialoguePacingReportRowPtr Item;
+};
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+TSharedRef<SDockTab> SDialoguePacingReport::SpawnTab(const FSpawnTabArgs &Args)
+{
+	return
+		SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		.Label(LOCTEXT("TabTitle", "Dialogue Pacing"))
+		[
+			SNew(SDialoguePacingReport)
+		];
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialoguePacingReport::Construct(const FArguments &InArgs)
+{
+	RowListView = SNew(SListView<FDialoguePacingReportRowPtr>)
+		.ListItemsSource(&FilteredRows)
+		.OnGenerateRow(this, &SDialoguePacingReport::OnGenerateRow)
+		.SelectionMode(ESelectionMode::None)
+		.HeaderRow
+		(
+			SNew(SHeaderRow)
+			+ SHeaderRow::Column(Column_Script).DefaultLabel(LOCTEXT("ScriptColumn", "Script / Key")).FillWidth(0.25f)
+			+ SHeaderRow::Column(Column_Lines).DefaultLabel(LOCTEXT("LinesColumn", "Lines")).FillWidth(0.07f)
+			+ SHeaderRow::Column(Column_Early).DefaultLabel(LOCTEXT("EarlyColumn", "Skipped Early")).FillWidth(0.08f)
+			+ SHeaderRow::Column(Column_Ratio).DefaultLabel(LOCTEXT("RatioColumn", "Shown / Delay 0..1.5")).FillWidth(0.15f)
+			+ SHeaderRow::Column(Column_TimePerLetter).DefaultLabel(LOCTEXT("TimePerLetterColumn", "Time Per Letter")).FillWidth(0.15f)
+			+ SHeaderRow::Column(Column_AdditionalTextTime).DefaultLabel(LOCTEXT("AdditionalTextTimeColumn", "Additional Text Time")).FillWidth(0.15f)
+			+ SHeaderRow::Column(Column_MinimumTextTime).DefaultLabel(LOCTEXT("MinimumTextTimeColumn", "Minimum Text Time")).FillWidth(0.15f)
+		);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("Filter", "Script or key..."))
+				.OnTextChanged(this, &SDialoguePacingReport::OnFilterTextChanged)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 0.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda([this]() { return bShowKeys ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged(this, &SDialoguePacingReport::OnShowKeysChanged)
+				[
+					SNew(STextBlock).Text(LOCTEXT("ShowKeys", "Show Keys"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("Reload", "Reload"))
+				.OnClicked(this, &SDialoguePacingReport::OnReloadClicked)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("Export", "Export CSV"))
+				.OnClicked(this, &SDialoguePacingReport::OnExportClicked)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(STextBlock)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+			.Text(this, &SDialoguePacingReport::GetStatusText)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			RowListView.ToSharedRef()
+		]
+	];
+
+	Reload();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialoguePacingReport::Reload()
+{
+	FDialoguePacing Pacing;
+	NumFiles = Pacing.LoadDirectory();
+
+	//Lines recorded by play in editor this session. Saving clears them, so none of these are in the files too
+	Pacing.Merge(FDialoguePacing::Get());
+
+	Rows.Reset();
+
+	auto AddRow = [this](FName InScript, FName InKey, const FDialoguePacingHistogram &InHistogram)
+	{
+		FDialoguePacingReportRowPtr Row = MakeShareable(new FDialoguePacingReportRow);
+		Row->Script = InScript;
+		Row->Key = InKey;
+		Row->Histogram = InHistogram;
+		Row->ScriptText = FText::FromName(InScript);
+		Row->KeyText = FText::FromString(FString::Printf(TEXT("    %s"), *InKey.ToString()));
+
+		float flTimePerLetter = 0.0f;
+		float flAdditionalTextTime = 0.0f;
+		if (InHistogram.FitTiming(flTimePerLetter, flAdditionalTextTime))
+		{
+			Row->TimePerLetter = FMath::Max(flTimePerLetter, 0.0f);
+			Row->AdditionalTextTime = FMath::Max(flAdditionalTextTime, 0.0f);
+		}
+
+		if (InHistogram.NumFit > 0)
+		{
+			Row->MinimumTextTime = InHistogram.GetShownPercentile(MinimumTextTimePercentile);
+		}
+
+		Rows.Add(Row);
+	};
+
+	for (auto It = Pacing.GetScripts().CreateConstIterator(); It; ++It)
+	{
+		AddRow(It.Key(), NAME_None, It.Value());
+	}
+
+	for (auto It = Pacing.GetKeys().CreateConstIterator(); It; ++It)
+	{
+		AddRow(It.Key().Key, It.Key().Value, It.Value());
+	}
+
+	//Keys right below their script
+	Rows.Sort([](const FDialoguePacingReportRowPtr &A, const FDialoguePacingReportRowPtr &B)
+	{
+		if (A->Script != B->Script)
+			return A->Script.LexicalLess(B->Script);
+
+		if (A->Key.IsNone() != B->Key.IsNone())
+			return A->Key.IsNone();
+
+		return A->Key.LexicalLess(B->Key);
+	});
+
+	UpdateFilteredRows();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialoguePacingReport::UpdateFilteredRows()
+{
+	FilteredRows.Reset(Rows.Num());
+
+	for (int32 i=0; i<Rows.Num(); i++)
+	{
+		const FDialoguePacingReportRow &Row = *Rows.GetData()[i];
+		if (!bShowKeys && !Row.Key.IsNone())
+			continue;
+
+		if (FilterString.Len() > 0 && !Row.Script.ToString().Contains(FilterString) && !Row.Key.ToString().Contains(FilterString))
+			continue;
+
+		FilteredRows.Add(Rows.GetData()[i]);
+	}
+
+	if (RowListView.IsValid())
+	{
+		RowListView->RequestListRefresh();
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialoguePacingReport::OnFilterTextChanged(const FText &InFilterText)
+{
+	FilterString = InFilterText.ToString();
+	UpdateFilteredRows();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void SDialoguePacingReport::OnShowKeysChanged(ECheckBoxState InState)
+{
+	bShowKeys = InState == ECheckBoxState::Checked;
+	UpdateFilteredRows();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FReply SDialoguePacingReport::OnReloadClicked()
+{
+	Reload();
+	return FReply::Handled();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FReply SDialoguePacingReport::OnExportClicked()
+{
+	FString Csv = TEXT("Script,Key,Lines,SkippedEarly,Untimed,AverageShown,AverageDelay,TimePerLetter,AdditionalTextTime,MinimumTextTime\n");
+
+	for (int32 i=0; i<Rows.Num(); i++)
+	{
+		const FDialoguePacingReportRow &Row = *Rows.GetData()[i];
+		const FDialoguePacingHistogram &Histogram = Row.Histogram;
+
+		Csv += FString::Printf(TEXT("%s,%s,%u,%u,%u,%.3f,%.3f,%s,%s,%s\n"),
+			*Row.Script.ToString(),
+			Row.Key.IsNone() ? TEXT("") : *Row.Key.ToString(),
+			Histogram.NumLines,
+			Histogram.NumSkippedEarly,
+			Histogram.NumUntimed,
+			Histogram.NumLines > 0 ? Histogram.TotalShown / Histogram.NumLines : 0.0,
+			Histogram.NumLines > 0 ? Histogram.TotalDelay / Histogram.NumLines : 0.0,
+			Row.TimePerLetter.IsSet() ? *FString::Printf(TEXT("%.4f"), Row.TimePerLetter.GetValue()) : TEXT(""),
+			Row.AdditionalTextTime.IsSet() ? *FString::Printf(TEXT("%.3f"), Row.AdditionalTextTime.GetValue()) : TEXT(""),
+			Row.MinimumTextTime.IsSet() ? *FString::Printf(TEXT("%.3f"), Row.MinimumTextTime.GetValue()) : TEXT(""));
+	}
+
+	const FString Filename = FDialoguePacing::GetDirectory() / TEXT("PacingReport.csv");
+	if (FFileHelper::SaveStringToFile(Csv, *Filename))
+	{
+		UE_LOG(LogTemp, Display, TEXT("Dialogue pacing report written to %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write dialogue pacing report to %s"), *Filename);
+	}
+
+	return FReply::Handled();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FText SDialoguePacingReport::GetStatusText() const
+{
+	const UDialogueManager *pDefaults = GetDefault<UDialogueManager>();
+
+	return FText::Format(LOCTEXT("Status", "{0} files, {1} rows shown. Current defaults: Time Per Letter {2}, Additional Text Time {3}, Minimum Text Time {4}"),
+		FText::AsNumber(NumFiles),
+		FText::AsNumber(FilteredRows.Num()),
+		FText::AsNumber(pDefaults->GetTimePerLetter()),
+		FText::AsNumber(pDefaults->GetAdditionalTextTime()),
+		FText::AsNumber(pDefaults->GetMinimumTextTime()));
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+TSharedRef<ITableRow> SDialoguePacingReport::OnGenerateRow(FDialoguePacingReportRowPtr InItem, const TSharedRef<STableViewBase> &OwnerTable)
+{
+	return SNew(SDialoguePacingReportRow, OwnerTable, InItem);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void OpenDialoguePacingReport(const TArray<FString> &Args)
+{
+	FGlobalTabmanager::Get()->TryInvokeTab(SDialoguePacingReport::TabName);
+}
+
+static FAutoConsoleCommand OpenDialoguePacingReportCommand(
+	TEXT("SimpleDialogue.Pacing.Report"),
+	TEXT("Opens the dialogue line pacing report"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&OpenDialoguePacingReport));
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,83 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Dialogue/DialoguePacing.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialoguePacingReportRow
+{
+	FName Script;
+
+	//None for the script total
+	FName Key;
+
+	FDialoguePacingHistogram Histogram;
+
+	//Suggested settings, unset when there were too few lines advanced by hand
+	TOptional<float> TimePerLetter;
+	TOptional<float> AdditionalTextTime;
+	TOptional<float> MinimumTextTime;
+
+	FText ScriptText;
+	FText KeyText;
+};
+
+typedef TSharedPtr<FDialoguePacingReportRow> FDialoguePacingReportRowPtr;
+
+//===========================================================================================================================
+// Line timing recorded by playtests, see FDialoguePacing. One row per script with the TimePerLetter,
+// AdditionalTextTime and MinimumTextTime its players actually read at, next to the dialogue manager defaults.
+//===========================================================================================================================
+class SDialoguePacingReport : public SCompoundWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SDialoguePacingReport) {}
+	SLATE_END_ARGS()
+
+	//
+	void Construct(const FArguments &InArgs);
+
+	//
+	static const FName TabName;
+
+	//
+	static TSharedRef<class SDockTab> SpawnTab(const class FSpawnTabArgs &Args);
+
+private:
+
+	//Reads every file in FDialoguePacing::GetDirectory again
+	void Reload();
+
+	//
+	void UpdateFilteredRows();
+	void OnFilterTextChanged(const FText &InFilterText);
+	void OnShowKeysChanged(ECheckBoxState InState);
+
+	//
+	FReply OnReloadClicked();
+	FReply OnExportClicked();
+
+	//
+	TSharedRef<class ITableRow> OnGenerateRow(FDialoguePacingReportRowPtr InItem, const TSharedRef<class STableViewBase> &OwnerTable);
+
+	//
+	FText GetStatusText() const;
+
+	TArray<FDialoguePacingReportRowPtr> Rows;
+	TArray<FDialoguePacingReportRowPtr> FilteredRows;
+	TSharedPtr<SListView<FDialoguePacingReportRowPtr>> RowListView;
+
+	FString FilterString;
+	bool bShowKeys = false;
+
+	int32 NumFiles = 0;
+};
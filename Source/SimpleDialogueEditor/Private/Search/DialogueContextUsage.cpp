@@ -0,0 +1,281 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Search/DialogueContextUsage.h"
+#include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueManager.h"
+#include "Dialogue/DialogueContext.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_CallFunction.h"
+#include "UObject/UnrealType.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void SerializeTag(FArchive &Ar, FGameplayTag &Tag)
+{
+	FName TagName = Tag.GetTagName();
+	Ar << TagName;
+
+	if (Ar.IsLoading())
+	{
+		Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FArchive &operator<<(FArchive &Ar, FDialogueContextUsage &Usage)
+{
+	Ar << Usage.Asset;
+	SerializeTag(Ar, Usage.Tag);
+	SerializeTag(Ar, Usage.ActorTag);
+	Ar << Usage.Access;
+	Ar << Usage.Scope;
+	Ar << Usage.Source;
+	Ar << Usage.NodeGuid;
+	return Ar;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+struct FDialogueContextFunction
+{
+	FName Name;
+	EDialogueContextAccess Access;
+	EDialogueContextScope Scope;
+
+	//Only this class and its children, NULL for both UDialogue and UDialogueManager
+	const UClass *Owner;
+};
+
+//===========================================================================================================================
+// Same names are used by UDialogue and UDialogueManager
+//===========================================================================================================================
+static const FDialogueContextFunction *FindContextFunction(FName InName, const UClass *InOwnerClass)
+{
+	if (!InOwnerClass || (!InOwnerClass->IsChildOf(UDialogue::StaticClass()) && !InOwnerClass->IsChildOf(UDialogueManager::StaticClass())))
+		return NULL;
+
+	static const FDialogueContextFunction Functions[] =
+	{
+		{ TEXT("AddContext"),				EDialogueContextAccess::Write,		EDialogueContextScope::Actor },
+		{ TEXT("IncrementContext"),			EDialogueContextAccess::Write,		EDialogueContextScope::Actor },
+		{ TEXT("IncreaseContextToLimit"),	EDialogueContextAccess::Write,		EDialogueContextScope::Actor },
+		{ TEXT("RemoveContext"),			EDialogueContextAccess::Write,		EDialogueContextScope::Actor },
+		{ TEXT("HasContext"),				EDialogueContextAccess::Read,		EDialogueContextScope::Actor },
+		{ TEXT("GetContext"),				EDialogueContextAccess::Read,		EDialogueContextScope::Actor },
+		{ TEXT("AddContextTarget"),			EDialogueContextAccess::Write,		EDialogueContextScope::Target },
+		{ TEXT("IncrementContextTarget"),	EDialogueContextAccess::Write,		EDialogueContextScope::Target },
+		{ TEXT("RemoveContextTarget"),		EDialogueContextAccess::Write,		EDialogueContextScope::Target },
+		{ TEXT("HasContextTarget"),			EDialogueContextAccess::Read,		EDialogueContextScope::Target },
+		{ TEXT("GetContextTarget"),			EDialogueContextAccess::Read,		EDialogueContextScope::Target },
+		{ TEXT("AddGlobalContext"),			EDialogueContextAccess::Write,		EDialogueContextScope::Global },
+		{ TEXT("IncrementGlobalContext"),	EDialogueContextAccess::Write,		EDialogueContextScope::Global },
+		{ TEXT("RemoveGlobalContext"),		EDialogueContextAccess::Write,		EDialogueContextScope::Global },
+		{ TEXT("HasGlobalContext"),			EDialogueContextAccess::Read,		EDialogueContextScope::Global },
+		{ TEXT("GetGlobalContext"),			EDialogueContextAccess::Read,		EDialogueContextScope::Global },
+		{ TEXT("MakeRandomRoll"),			EDialogueContextAccess::ReadWrite,	EDialogueContextScope::Target,	UDialogue::StaticClass() },
+		{ TEXT("MakeRandomRoll"),			EDialogueContextAccess::ReadWrite,	EDialogueContextScope::Actor,	UDialogueManager::StaticClass() },
+	};
+
+	for (int32 i=0; i<UE_ARRAY_COUNT(Functions); i++)
+	{
+		if (Functions[i].Name == InName && (!Functions[i].Owner || InOwnerClass->IsChildOf(Functions[i].Owner)))
+			return &Functions[i];
+	}
+
+	return NULL;
+}
+
+//===========================================================================================================================
+// (TagName="Context.Harbor.Bribed"), also finds the tag inside a whole FContextAndValue default value
+//===========================================================================================================================
+static FGameplayTag ParseTagFromDefaultValue(const FString &InValue)
+{
+	static const FString TagNameStart = TEXT("TagName=\"");
+
+	int32 iStart = InValue.Find(TagNameStart, ESearchCase::CaseSensitive);
+	if (iStart == INDEX_NONE)
+		return FGameplayTag();
+
+	iStart += TagNameStart.Len();
+
+	int32 iEnd = InValue.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, iStart);
+	if (iEnd == INDEX_NONE)
+		return FGameplayTag();
+
+	return FGameplayTag::RequestGameplayTag(FName(*InValue.Mid(iStart, iEnd - iStart)), false);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueContextUsageGatherer::GatherFromGraphs(class UBlueprint *InBlueprint, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages)
+{
+	static const FName Name_Tag = TEXT("InTag");
+	static const FName Name_ActorTag = TEXT("InActorTag");
+
+	TArray<class UEdGraph*> Graphs;
+	InBlueprint->GetAllGraphs(Graphs);
+
+	for (int32 i=0; i<Graphs.Num(); i++)
+	{
+		class UEdGraph *pGraph = Graphs.GetData()[i];
+		if (!pGraph)
+			continue;
+
+		for (int32 j=0; j<pGraph->Nodes.Num(); j++)
+		{
+			class UEdGraphNode *pNode = pGraph->Nodes.GetData()[j];
+			if (!pNode)
+				continue;
+
+			//Context function calls
+			UK2Node_CallFunction *pCall = Cast<UK2Node_CallFunction>(pNode);
+			UFunction *pTarget = pCall ? pCall->GetTargetFunction() : NULL;
+			const FDialogueContextFunction *pFunction = pTarget ? FindContextFunction(pCall->FunctionReference.GetMemberName(), pTarget->GetOwnerClass()) : NULL;
+
+			if (pFunction)
+			{
+				const class UEdGraphPin *pTagPin = pNode->FindPin(Name_Tag, EGPD_Input);
+
+				//Only literal tags can be known without running the graph
+				if (pTagPin && pTagPin->LinkedTo.Num() == 0)
+				{
+					FDialogueContextUsage Usage;
+					Usage.Asset = InAsset;
+					Usage.Tag = ParseTagFromDefaultValue(pTagPin->DefaultValue);
+					Usage.Access = pFunction->Access;
+					Usage.Scope = pFunction->Scope;
+					Usage.Source = pFunction->Name.ToString();
+					Usage.NodeGuid = pNode->NodeGuid;
+
+					const class UEdGraphPin *pActorPin = pNode->FindPin(Name_ActorTag, EGPD_Input);
+					if (pActorPin && pActorPin->LinkedTo.Num() == 0)
+					{
+						Usage.ActorTag = ParseTagFromDefaultValue(pActorPin->DefaultValue);
+					}
+
+					if (Usage.Tag.IsValid())
+					{
+						OutUsages.Add(Usage);
+					}
+				}
+
+				continue;
+			}
+
+			//FContextAndValue pins with a default value, for example in Make and function call nodes
+			for (int32 k=0; k<pNode->Pins.Num(); k++)
+			{
+				const class UEdGraphPin *pPin = pNode->Pins.GetData()[k];
+				if (!pPin || pPin->Direction != EGPD_Input || pPin->LinkedTo.Num() > 0 || pPin->PinType.PinSubCategoryObject.Get() != FContextAndValue::StaticStruct())
+					continue;
+
+				FDialogueContextUsage Usage;
+				Usage.Asset = InAsset;
+				Usage.Tag = ParseTagFromDefaultValue(pPin->DefaultValue);
+				Usage.Access = EDialogueContextAccess::Property;
+				Usage.Scope = EDialogueContextScope::Actor;
+				Usage.Source = pPin->GetDisplayName().ToString();
+				Usage.NodeGuid = pNode->NodeGuid;
+
+				if (Usage.Tag.IsValid())
+				{
+					OutUsages.Add(Usage);
+				}
+			}
+		}
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueContextUsageGatherer::GatherFromProperty(const class FProperty *InProperty, const void *InValue, const FString &InPath, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages, int32 InDepth)
+{
+	//Nothing sensible is this deep, stops recursive structs
+	if (InDepth > 8)
+		return;
+
+	if (const FStructProperty *pStructProperty = CastField<FStructProperty>(InProperty))
+	{
+		if (pStructProperty->Struct == FContextAndValue::StaticStruct())
+		{
+			const FContextAndValue *pContext = (const FContextAndValue*)InValue;
+			if (pContext->GetTag().IsValid())
+			{
+				FDialogueContextUsage Usage;
+				Usage.Asset = InAsset;
+				Usage.Tag = pContext->GetTag();
+				Usage.Access = EDialogueContextAccess::Property;
+				Usage.Scope = EDialogueContextScope::Actor;
+				Usage.Source = InPath;
+				OutUsages.Add(Usage);
+			}
+			return;
+		}
+
+		for (TFieldIterator<FProperty> It(pStructProperty->Struct); It; ++It)
+		{
+			GatherFromProperty(*It, It->ContainerPtrToValuePtr<void>(InValue), InPath + TEXT(".") + It->GetName(), InAsset, OutUsages, InDepth + 1);
+		}
+		return;
+	}
+
+	if (const FArrayProperty *pArrayProperty = CastField<FArrayProperty>(InProperty))
+	{
+		//Only arrays of structs can hold contexts
+		if (!pArrayProperty->Inner->IsA<FStructProperty>())
+			return;
+
+		FScriptArrayHelper Helper(pArrayProperty, InValue);
+		for (int32 i=0; i<Helper.Num(); i++)
+		{
+			GatherFromProperty(pArrayProperty->Inner, Helper.GetRawPtr(i), FString::Printf(TEXT("%s[%d]"), *InPath, i), InAsset, OutUsages, InDepth + 1);
+		}
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueContextUsageGatherer::GatherFromDefaults(class UBlueprint *InBlueprint, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages)
+{
+	UClass *pClass = InBlueprint->GeneratedClass;
+	UObject *pDefaults = pClass ? pClass->GetDefaultObject(false) : NULL;
+	if (!pDefaults)
+		return;
+
+	for (TFieldIterator<FProperty> It(pClass); It; ++It)
+	{
+		for (int32 i=0; i<It->ArrayDim; i++)
+		{
+			FString Path = It->ArrayDim > 1 ? FString::Printf(TEXT("%s[%d]"), *It->GetName(), i) : It->GetName();
+			GatherFromProperty(*It, It->ContainerPtrToValuePtr<void>(pDefaults, i), Path, InAsset, OutUsages, 0);
+		}
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void FDialogueContextUsageGatherer::Gather(class UBlueprint *InBlueprint, TArray<FDialogueContextUsage> &OutUsages)
+{
+	OutUsages.Reset();
+
+	if (!IsValid(InBlueprint))
+		return;
+
+	FSoftObjectPath Asset(InBlueprint);
+
+	GatherFromGraphs(InBlueprint, Asset, OutUsages);
+	GatherFromDefaults(InBlueprint, Asset, OutUsages);
+}
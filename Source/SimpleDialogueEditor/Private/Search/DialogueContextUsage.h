@@ -0,0 +1,99 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "DialogueContextUsage.generated.h"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+UENUM(BlueprintType)
+enum class EDialogueContextAccess : uint8
+{
+	Read,
+	Write,
+
+	//MakeRandomRoll reads and adds the value if missing
+	ReadWrite,
+
+	//FContextAndValue property or pin, can be either depending on what uses it
+	Property,
+};
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+UENUM(BlueprintType)
+enum class EDialogueContextScope : uint8
+{
+	//Actor tag comes from a pin
+	Actor,
+
+	//Dialogue target, the *Target functions
+	Target,
+
+	//The *Global functions
+	Global,
+};
+
+//===========================================================================================================================
+// One place where a dialogue script uses a context tag
+//===========================================================================================================================
+USTRUCT(BlueprintType)
+struct FDialogueContextUsage
+{
+	GENERATED_BODY()
+
+	//
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	FSoftObjectPath Asset;
+
+	//
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	FGameplayTag Tag;
+
+	//Literal actor tag if the scope is Actor and the pin is not linked
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	FGameplayTag ActorTag;
+
+	//
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	EDialogueContextAccess Access = EDialogueContextAccess::Read;
+
+	//
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	EDialogueContextScope Scope = EDialogueContextScope::Actor;
+
+	//Function name, or property path for class defaults
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	FString Source;
+
+	//Invalid for class default properties
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Context")
+	FGuid NodeGuid;
+
+	friend FArchive &operator<<(FArchive &Ar, FDialogueContextUsage &Usage);
+};
+
+//===========================================================================================================================
+// Static analysis of dialogue blueprints. Finds context function calls with a literal tag pin, FContextAndValue
+// pins with default values and FContextAndValue properties in the class defaults.
+//===========================================================================================================================
+class FDialogueContextUsageGatherer
+{
+public:
+
+	//
+	static void Gather(class UBlueprint *InBlueprint, TArray<FDialogueContextUsage> &OutUsages);
+
+private:
+
+	//
+	static void GatherFromGraphs(class UBlueprint *InBlueprint, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages);
+	static void GatherFromDefaults(class UBlueprint *InBlueprint, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages);
+	static void GatherFromProperty(const class FProperty *InProperty, const void *InValue, const FString &InPath, const FSoftObjectPath &InAsset, TArray<FDialogueContextUsage> &OutUsages, int32 InDepth);
+};
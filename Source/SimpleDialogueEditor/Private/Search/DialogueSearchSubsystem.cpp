@@ -0,0 +1,701 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#include "Search/DialogueSearchSubsystem.h"
+#include "DialogueInspectorEditor.h"
+#include "Dialogue/Dialogue.h"
+#include "Dialogue/DialogueScriptDerivedData.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Editor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "UObject/UObjectHash.h"
+
+//Bump when the file layout or tokenizing changes
+static const int32 DialogueSearchIndexVersion = 4;
+
+#define LOCTEXT_NAMESPACE "DialogueSearch"
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FArchive &operator<<(FArchive &Ar, FDialogueSearchResult &Result)
+{
+	Ar << Result.Asset;
+	Ar << Result.Text;
+	Ar << Result.Speaker;
+	Ar << Result.TableId;
+	Ar << Result.Key;
+	Ar << Result.NodeGuid;
+	Ar << Result.PinId;
+	return Ar;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadIndex();
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UDialogueSearchSubsystem::OnPackageSaved);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::Deinitialize()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	Super::Deinitialize();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+FString UDialogueSearchSubsystem::GetIndexFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SimpleDialogue") / TEXT("SearchIndex.bin");
+}
+
+//===========================================================================================================================
+// Lower case runs of letters and digits
+//===========================================================================================================================
+void UDialogueSearchSubsystem::Tokenize(const FString &InString, TSet<FString> &OutTokens)
+{
+	const TCHAR *pChars = *InString;
+	int32 iStart = INDEX_NONE;
+
+	for (int32 i=0; i<=InString.Len(); i++)
+	{
+		bool bIsWordChar = i < InString.Len() && FChar::IsAlnum(pChars[i]);
+		if (bIsWordChar)
+		{
+			if (iStart == INDEX_NONE)
+			{
+				iStart = i;
+			}
+			continue;
+		}
+
+		if (iStart != INDEX_NONE)
+		{
+			OutTokens.Add(InString.Mid(iStart, i - iStart).ToLower());
+			iStart = INDEX_NONE;
+		}
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::RemoveDocument(int32 Index)
+{
+	FDocument &Document = Documents.GetData()[Index];
+
+	TSet<FString> DocumentTokens;
+	for (int32 i=0; i<Document.Lines.Num(); i++)
+	{
+		const FDialogueSearchResult &Line = Document.Lines.GetData()[i];
+		Tokenize(Line.Text, DocumentTokens);
+		Tokenize(Line.Speaker, DocumentTokens);
+		Tokenize(Line.Key, DocumentTokens);
+	}
+
+	for (const FString &Token : DocumentTokens)
+	{
+		TArray<FPosting> *pPostings = Tokens.Find(Token);
+		if (!pPostings)
+			continue;
+
+		pPostings->RemoveAll([Index](const FPosting &Posting) { return Posting.Document == Index; });
+		if (pPostings->Num() == 0)
+		{
+			Tokens.Remove(Token);
+		}
+	}
+
+	for (int32 i=0; i<Document.ContextUsages.Num(); i++)
+	{
+		FName TagName = Document.ContextUsages.GetData()[i].Tag.GetTagName();
+
+		TArray<FPosting> *pPostings = ContextTags.Find(TagName);
+		if (!pPostings)
+			continue;
+
+		pPostings->RemoveAll([Index](const FPosting &Posting) { return Posting.Document == Index; });
+		if (pPostings->Num() == 0)
+		{
+			ContextTags.Remove(TagName);
+		}
+	}
+
+	PackageToDocument.Remove(Document.PackageName);
+	Document = FDocument();
+	FreeDocuments.Add(Index);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::SetDocument(const FString &InPackageName, const FString &InHash, TArray<FDialogueSearchResult> &&InLines, TArray<FDialogueContextUsage> &&InContextUsages)
+{
+	const int32 *pExisting = PackageToDocument.Find(InPackageName);
+	if (pExisting)
+	{
+		RemoveDocument(*pExisting);
+	}
+
+	int32 iDocument = FreeDocuments.Num() > 0 ? FreeDocuments.Pop() : Documents.AddDefaulted();
+
+	FDocument &Document = Documents.GetData()[iDocument];
+	Document.PackageName = InPackageName;
+	Document.Hash = InHash;
+	Document.Lines = MoveTemp(InLines);
+	Document.ContextUsages = MoveTemp(InContextUsages);
+
+	PackageToDocument.Add(InPackageName, iDocument);
+
+	TSet<FString> LineTokens;
+	for (int32 i=0; i<Document.Lines.Num(); i++)
+	{
+		const FDialogueSearchResult &Line = Document.Lines.GetData()[i];
+
+		LineTokens.Reset();
+		Tokenize(Line.Text, LineTokens);
+		Tokenize(Line.Speaker, LineTokens);
+		Tokenize(Line.Key, LineTokens);
+
+		for (const FString &Token : LineTokens)
+		{
+			Tokens.FindOrAdd(Token).Add({ iDocument, i });
+		}
+	}
+
+	for (int32 i=0; i<Document.ContextUsages.Num(); i++)
+	{
+		ContextTags.FindOrAdd(Document.ContextUsages.GetData()[i].Tag.GetTagName()).Add({ iDocument, i });
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+bool UDialogueSearchSubsystem::IndexPackage(class UPackage *InPackage, const FString &InHash)
+{
+	if (!InPackage)
+		return false;
+
+	TArray<FDialogueSearchResult> Lines;
+	TArray<FDialogueContextUsage> ContextUsages;
+	bool bFound = false;
+
+	ForEachObjectWithPackage(InPackage, [&Lines, &ContextUsages, &bFound](UObject *pObject)
+	{
+		//Dialogue script
+		class UBlueprint *pBlueprint = Cast<UBlueprint>(pObject);
+		if (pBlueprint && pBlueprint->GeneratedClass && pBlueprint->GeneratedClass->IsChildOf(UDialogue::StaticClass()))
+		{
+			bFound = true;
+
+			TArray<FDialogueScriptLine> ScriptLines;
+			FDialogueScriptDerivedData::GetLines(pBlueprint, ScriptLines);
+
+			FSoftObjectPath Asset(pBlueprint);
+			for (int32 i=0; i<ScriptLines.Num(); i++)
+			{
+				const FDialogueScriptLine &ScriptLine = ScriptLines.GetData()[i];
+
+				FDialogueSearchResult &Line = Lines.AddDefaulted_GetRef();
+				Line.Asset = Asset;
+				Line.Text = ScriptLine.Text.ToString();
+				Line.Speaker = ScriptLine.Speaker;
+				Line.TableId = ScriptLine.TableId;
+				Line.Key = ScriptLine.Key;
+				Line.NodeGuid = ScriptLine.NodeGuid;
+				Line.PinId = ScriptLine.PinId;
+			}
+
+			FDialogueContextUsageGatherer::Gather(pBlueprint, ContextUsages);
+			return true;
+		}
+
+		//String table
+		class UStringTable *pStringTable = Cast<UStringTable>(pObject);
+		if (pStringTable)
+		{
+			bFound = true;
+
+			FSoftObjectPath Asset(pStringTable);
+			FString TableId = pStringTable->GetStringTableId().ToString();
+
+			pStringTable->GetStringTable()->EnumerateSourceStrings([&Lines, &Asset, &TableId](const FString &InKey, const FString &InSourceString)
+			{
+				FDialogueSearchResult &Line = Lines.AddDefaulted_GetRef();
+				Line.Asset = Asset;
+				Line.Text = InSourceString;
+				Line.TableId = TableId;
+				Line.Key = InKey;
+				return true;
+			});
+		}
+
+		return true;
+	}, false);
+
+	if (!bFound)
+		return false;
+
+	SetDocument(InPackage->GetName(), InHash, MoveTemp(Lines), MoveTemp(ContextUsages));
+	return true;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::RefreshIndex()
+{
+	IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UStringTable::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	FScopedSlowTask SlowTask((float)Assets.Num(), LOCTEXT("RefreshIndex", "Indexing dialogue texts"));
+	SlowTask.MakeDialog(true);
+
+	TSet<FString> SeenPackages;
+
+	for (int32 i=0; i<Assets.Num(); i++)
+	{
+		SlowTask.EnterProgressFrame();
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const FAssetData &AssetData = Assets.GetData()[i];
+
+		//Skip blueprints that are not dialogues without loading them
+		if (!AssetData.IsInstanceOf(UStringTable::StaticClass()))
+		{
+			FString ParentClassPath;
+			if (!AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassPath))
+				continue;
+
+			UClass *pParentClass = FindObject<UClass>(NULL, *FPackageName::ExportTextPathToObjectPath(ParentClassPath));
+			if (!pParentClass || !pParentClass->IsChildOf(UDialogue::StaticClass()))
+				continue;
+		}
+
+		FString PackageName = AssetData.PackageName.ToString();
+		SeenPackages.Add(PackageName);
+
+		FString Hash = FDialogueScriptDerivedData::GetSavedPackageKey(AssetData.PackageName);
+
+		const int32 *pDocument = PackageToDocument.Find(PackageName);
+		if (pDocument && Hash.Len() > 0 && Documents.GetData()[*pDocument].Hash == Hash)
+			continue;
+
+		UObject *pAsset = AssetData.GetAsset();
+		if (pAsset)
+		{
+			IndexPackage(pAsset->GetOutermost(), Hash);
+		}
+	}
+
+	//Deleted packages
+	TArray<int32> Removed;
+	for (const TPair<FString, int32> &Pair : PackageToDocument)
+	{
+		if (!SeenPackages.Contains(Pair.Key))
+		{
+			Removed.Add(Pair.Value);
+		}
+	}
+
+	if (!SlowTask.ShouldCancel())
+	{
+		for (int32 i=0; i<Removed.Num(); i++)
+		{
+			RemoveDocument(Removed.GetData()[i]);
+		}
+	}
+
+	bHasIndex = true;
+	SaveIndex();
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::Search(const FString &InQuery, TArray<FDialogueSearchResult> &OutResults, int32 InMaxResults)
+{
+	OutResults.Reset();
+
+	//Keep the order of the words, the last one is the one still being typed
+	TArray<FString> Words;
+	InQuery.ToLower().ParseIntoArrayWS(Words);
+
+	TArray<FString> QueryTokens;
+	for (int32 i=0; i<Words.Num(); i++)
+	{
+		TSet<FString> WordTokens;
+		Tokenize(Words.GetData()[i], WordTokens);
+		for (const FString &Token : WordTokens)
+		{
+			QueryTokens.Add(Token);
+		}
+	}
+
+	if (QueryTokens.Num() == 0)
+		return;
+
+	//Posting lists of every word, last word also by prefix
+	TArray<TSet<uint64>> Matches;
+	Matches.SetNum(QueryTokens.Num());
+
+	for (int32 i=0; i<QueryTokens.Num(); i++)
+	{
+		const FString &Token = QueryTokens.GetData()[i];
+		TSet<uint64> &Set = Matches.GetData()[i];
+
+		auto AddPostings = [&Set](const TArray<FPosting> &Postings)
+		{
+			for (int32 j=0; j<Postings.Num(); j++)
+			{
+				Set.Add(((uint64)(uint32)Postings.GetData()[j].Document << 32) | (uint32)Postings.GetData()[j].Line);
+			}
+		};
+
+		if (i == QueryTokens.Num() - 1)
+		{
+			for (const TPair<FString, TArray<FPosting>> &Pair : Tokens)
+			{
+				if (Pair.Key.StartsWith(Token, ESearchCase::CaseSensitive))
+				{
+					AddPostings(Pair.Value);
+				}
+			}
+		}
+		else if (const TArray<FPosting> *pPostings = Tokens.Find(Token))
+		{
+			AddPostings(*pPostings);
+		}
+
+		if (Set.Num() == 0)
+			return;
+	}
+
+	//Intersect starting from the smallest set
+	Matches.Sort([](const TSet<uint64> &A, const TSet<uint64> &B) { return A.Num() < B.Num(); });
+
+	TArray<uint64> Hits;
+	for (uint64 Hit : Matches.GetData()[0])
+	{
+		bool bInAll = true;
+		for (int32 i=1; i<Matches.Num() && bInAll; i++)
+		{
+			bInAll = Matches.GetData()[i].Contains(Hit);
+		}
+
+		if (bInAll)
+		{
+			Hits.Add(Hit);
+		}
+	}
+
+	Hits.Sort();
+
+	for (int32 i=0; i<Hits.Num() && OutResults.Num() < InMaxResults; i++)
+	{
+		int32 iDocument = (int32)(Hits.GetData()[i] >> 32);
+		int32 iLine = (int32)(Hits.GetData()[i] & 0xffffffff);
+		OutResults.Add(Documents.GetData()[iDocument].Lines.GetData()[iLine]);
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+bool UDialogueSearchSubsystem::JumpToResult(const FDialogueSearchResult &InResult)
+{
+	UObject *pAsset = InResult.Asset.TryLoad();
+	if (!pAsset)
+		return false;
+
+	class UBlueprint *pBlueprint = Cast<UBlueprint>(pAsset);
+	if (pBlueprint && InResult.NodeGuid.IsValid())
+	{
+		class UEdGraphPin *pPin = FDialogueScriptDerivedData::FindPin(pBlueprint, InResult.NodeGuid, InResult.PinId);
+		if (pPin)
+		{
+			FDialogueInspectorEditor::JumpToPin(pBlueprint, pPin);
+			return true;
+		}
+	}
+
+	return GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(pAsset);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::FindContextUsages(FGameplayTag InTag, bool bIncludeChildTags, TArray<FDialogueContextUsage> &OutUsages)
+{
+	OutUsages.Reset();
+
+	if (!InTag.IsValid())
+		return;
+
+	auto AddPostings = [this, &OutUsages](const TArray<FPosting> &Postings)
+	{
+		for (int32 i=0; i<Postings.Num(); i++)
+		{
+			const FPosting &Posting = Postings.GetData()[i];
+			OutUsages.Add(Documents.GetData()[Posting.Document].ContextUsages.GetData()[Posting.Line]);
+		}
+	};
+
+	if (!bIncludeChildTags)
+	{
+		if (const TArray<FPosting> *pPostings = ContextTags.Find(InTag.GetTagName()))
+		{
+			AddPostings(*pPostings);
+		}
+		return;
+	}
+
+	FString Parent = InTag.ToString();
+	FString ChildPrefix = Parent + TEXT(".");
+
+	for (const TPair<FName, TArray<FPosting>> &Pair : ContextTags)
+	{
+		FString TagString = Pair.Key.ToString();
+		if (TagString.Equals(Parent, ESearchCase::IgnoreCase) || TagString.StartsWith(ChildPrefix, ESearchCase::IgnoreCase))
+		{
+			AddPostings(Pair.Value);
+		}
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+bool UDialogueSearchSubsystem::JumpToContextUsage(const FDialogueContextUsage &InUsage)
+{
+	UObject *pAsset = InUsage.Asset.TryLoad();
+	if (!pAsset)
+		return false;
+
+	class UBlueprint *pBlueprint = Cast<UBlueprint>(pAsset);
+	if (pBlueprint && InUsage.NodeGuid.IsValid())
+	{
+		class UEdGraphNode *pNode = FBlueprintEditorUtils::GetNodeByGUID(pBlueprint, InUsage.NodeGuid);
+		if (pNode)
+		{
+			FKismetEditorUtilities::BringKismetToFocusAttentionOnObject(pNode);
+			return true;
+		}
+	}
+
+	return GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(pAsset);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::OnPackageSaved(const FString &InFilename, class UPackage *InPackage, FObjectPostSaveContext InContext)
+{
+	if (!InPackage || InContext.IsProceduralSave())
+		return;
+
+	if (IndexPackage(InPackage, FDialogueScriptDerivedData::GetSavedPackageKey(InPackage->GetFName())))
+	{
+		SaveIndex();
+	}
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::LoadIndex()
+{
+	Documents.Reset();
+	FreeDocuments.Reset();
+	PackageToDocument.Reset();
+	Tokens.Reset();
+	ContextTags.Reset();
+	bHasIndex = false;
+
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileReader(*GetIndexFilename()));
+	if (!File)
+		return;
+
+	//Plain file archives do not serialize names
+	FNameAsStringProxyArchive Reader(*File);
+
+	int32 iVersion = 0;
+	Reader << iVersion;
+	if (iVersion != DialogueSearchIndexVersion)
+		return;
+
+	Reader << Documents;
+	Reader << FreeDocuments;
+	Reader << Tokens;
+	Reader << ContextTags;
+
+	if (Reader.IsError())
+	{
+		Documents.Reset();
+		FreeDocuments.Reset();
+		Tokens.Reset();
+		ContextTags.Reset();
+		return;
+	}
+
+	for (int32 i=0; i<Documents.Num(); i++)
+	{
+		if (Documents.GetData()[i].PackageName.Len() > 0)
+		{
+			PackageToDocument.Add(Documents.GetData()[i].PackageName, i);
+		}
+	}
+
+	bHasIndex = true;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+void UDialogueSearchSubsystem::SaveIndex()
+{
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*GetIndexFilename()));
+	if (!File)
+		return;
+
+	FNameAsStringProxyArchive Writer(*File);
+
+	int32 iVersion = DialogueSearchIndexVersion;
+	Writer << iVersion;
+	Writer << Documents;
+	Writer << FreeDocuments;
+	Writer << Tokens;
+	Writer << ContextTags;
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void SearchDialogueTexts(const TArray<FString> &Args)
+{
+	UDialogueSearchSubsystem *pSearch = GEditor ? GEditor->GetEditorSubsystem<UDialogueSearchSubsystem>() : NULL;
+	if (!pSearch)
+		return;
+
+	if (!pSearch->HasIndex())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No dialogue search index yet, run SimpleDialogue.Search.Refresh first"));
+		return;
+	}
+
+	double flStart = FPlatformTime::Seconds();
+
+	TArray<FDialogueSearchResult> Results;
+	pSearch->Search(FString::Join(Args, TEXT(" ")), Results);
+
+	double flTime = FPlatformTime::Seconds() - flStart;
+
+	for (int32 i=0; i<Results.Num(); i++)
+	{
+		const FDialogueSearchResult &Result = Results.GetData()[i];
+		UE_LOG(LogTemp, Display, TEXT("%s %s%s%s"), *Result.Asset.ToString(), *Result.Speaker, Result.Speaker.Len() > 0 ? TEXT(": ") : TEXT(""), *Result.Text);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("%d results in %.3f ms"), Results.Num(), flTime * 1000.0);
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static FAutoConsoleCommand SearchDialogueTextsCommand(
+	TEXT("SimpleDialogue.Search"),
+	TEXT("Searches every dialogue script and string table for lines containing all of the given words."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&SearchDialogueTexts));
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static void FindDialogueContextUsages(const TArray<FString> &Args)
+{
+	UDialogueSearchSubsystem *pSearch = GEditor ? GEditor->GetEditorSubsystem<UDialogueSearchSubsystem>() : NULL;
+	if (!pSearch || Args.Num() == 0)
+		return;
+
+	if (!pSearch->HasIndex())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No dialogue search index yet, run SimpleDialogue.Search.Refresh first"));
+		return;
+	}
+
+	FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*Args[0]), false);
+	if (!Tag.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Unknown tag \"%s\""), *Args[0]);
+		return;
+	}
+
+	TArray<FDialogueContextUsage> Usages;
+	pSearch->FindContextUsages(Tag, true, Usages);
+
+	for (int32 i=0; i<Usages.Num(); i++)
+	{
+		const FDialogueContextUsage &Usage = Usages.GetData()[i];
+		UE_LOG(LogTemp, Display, TEXT("%s %s %s %s %s"), *Usage.Asset.ToString(), *UEnum::GetValueAsString(Usage.Access), *Usage.Tag.ToString(), *Usage.Source, *Usage.ActorTag.ToString());
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("%d usages of %s"), Usages.Num(), *Tag.ToString());
+}
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static FAutoConsoleCommand FindDialogueContextUsagesCommand(
+	TEXT("SimpleDialogue.ContextUsages"),
+	TEXT("Lists every dialogue script that reads or writes the given context tag or its child tags."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FindDialogueContextUsages));
+
+//===========================================================================================================================
+//
+//===========================================================================================================================
+static FAutoConsoleCommand RefreshDialogueSearchCommand(
+	TEXT("SimpleDialogue.Search.Refresh"),
+	TEXT("Re-indexes dialogue scripts and string tables that changed since they were last indexed."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		UDialogueSearchSubsystem *pSearch = GEditor ? GEditor->GetEditorSubsystem<UDialogueSearchSubsystem>() : NULL;
+		if (pSearch)
+		{
+			pSearch->RefreshIndex();
+		}
+	}));
+
+#undef LOCTEXT_NAMESPACE
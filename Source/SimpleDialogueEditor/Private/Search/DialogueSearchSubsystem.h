@@ -0,0 +1,140 @@
+// Copyright Tero "Au-heppa" Knuutinen 2025.
+// Free to use for any personal project or company with less than 13 employees
+// Do not use to train AI / LLM / neural network
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Search/DialogueContextUsage.h"
+#include "DialogueSearchSubsystem.generated.h"
+
+//===========================================================================================================================
+// One line in a dialogue script or a string table
+//===========================================================================================================================
+USTRUCT(BlueprintType)
+struct FDialogueSearchResult
+{
+	GENERATED_BODY()
+
+	//Blueprint or string table
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FSoftObjectPath Asset;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FString Text;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FString Speaker;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FString TableId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FString Key;
+
+	//Invalid for string table entries
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FGuid NodeGuid;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Dialogue Search")
+	FGuid PinId;
+
+	friend FArchive &operator<<(FArchive &Ar, FDialogueSearchResult &Result);
+};
+
+//===========================================================================================================================
+// Inverted index from words to lines of every dialogue script and string table in the project, and from context
+// tags to the scripts that read or write them. Stored in Saved/SimpleDialogue so it survives editor restarts,
+// refreshed one package at a time when packages are saved.
+//
+// Queries never build the index. Until RefreshIndex has run once in the project they return nothing.
+//===========================================================================================================================
+UCLASS()
+class UDialogueSearchSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+	virtual void Deinitialize() override;
+
+	//False until RefreshIndex has run once in the project
+	UFUNCTION(BlueprintPure, Category = "Dialogue Search")
+	bool HasIndex() const { return bHasIndex; }
+
+	//Every word in the query has to be in the line. The last word also matches as a prefix
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Search")
+	void Search(const FString &InQuery, TArray<FDialogueSearchResult> &OutResults, int32 InMaxResults = 200);
+
+	//Opens the blueprint at the pin, or the string table
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Search")
+	bool JumpToResult(const FDialogueSearchResult &InResult);
+
+	//Every script that reads or writes the tag, or any of its child tags
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Search")
+	void FindContextUsages(FGameplayTag InTag, bool bIncludeChildTags, TArray<FDialogueContextUsage> &OutUsages);
+
+	//
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Search")
+	bool JumpToContextUsage(const FDialogueContextUsage &InUsage);
+
+	//Goes through every dialogue script and string table in the asset registry. Only packages whose saved hash
+	//changed since they were indexed are loaded
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Search")
+	void RefreshIndex();
+
+	//
+	static void Tokenize(const FString &InString, TSet<FString> &OutTokens);
+
+private:
+
+	//Packages without any lines or context usages are kept too, so they are not loaded again on every refresh
+	struct FDocument
+	{
+		FString PackageName;
+		FString Hash;
+		TArray<FDialogueSearchResult> Lines;
+		TArray<FDialogueContextUsage> ContextUsages;
+
+		friend FArchive &operator<<(FArchive &Ar, FDocument &Document) { return Ar << Document.PackageName << Document.Hash << Document.Lines << Document.ContextUsages; }
+	};
+
+	//
+	struct FPosting
+	{
+		int32 Document;
+		int32 Line;
+
+		friend FArchive &operator<<(FArchive &Ar, FPosting &Posting) { return Ar << Posting.Document << Posting.Line; }
+	};
+
+	//Returns false if the package has neither a dialogue script nor a string table
+	bool IndexPackage(class UPackage *InPackage, const FString &InHash);
+
+	//
+	void SetDocument(const FString &InPackageName, const FString &InHash, TArray<FDialogueSearchResult> &&InLines, TArray<FDialogueContextUsage> &&InContextUsages);
+	void RemoveDocument(int32 Index);
+
+	//
+	void LoadIndex();
+	void SaveIndex();
+	static FString GetIndexFilename();
+
+	//
+	void OnPackageSaved(const FString &InFilename, class UPackage *InPackage, FObjectPostSaveContext InContext);
+
+	//Slots of removed documents are reused
+	TArray<FDocument> Documents;
+	TArray<int32> FreeDocuments;
+	TMap<FString, int32> PackageToDocument;
+	TMap<FString, TArray<FPosting>> Tokens;
+
+	//Context tag name to FDocument::ContextUsages
+	TMap<FName, TArray<FPosting>> ContextTags;
+
+	bool bHasIndex = false;
+	FDelegateHandle PackageSavedHandle;
+};
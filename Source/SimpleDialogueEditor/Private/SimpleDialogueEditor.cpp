@@ -4,6 +4,13 @@
 #include "Modules/ModuleManager.h"
 #include "DetailCustomizations/ContextAndValueDetails.h"
 #include "Assets/AssetTypeActions_DialogueInspectorAsset.h"
+#include "Inspector/SDialogueContextInspector.h"
+#include "Inspector/SDialoguePacingReport.h"
+#include "Assets/DialogueLineDurationsBuilder.h"
+#include "Dialogue/DialogueLineDurations.h"
+#include "Framework/Docking/TabManager.h"
+#include "Framework/Application/SlateApplication.h"
+#include "UObject/UObjectGlobals.h"
 
 #define LOCTEXT_NAMESPACE "FSimpleDialogueEditorModule"
 
@@ -25,6 +32,24 @@ void FSimpleDialogueEditorModule::StartupModule()
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	PropertyModule.RegisterCustomPropertyTypeLayout("ContextAndValue", FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FContextAndValueDetails::MakeInstance));
 	PropertyModule.NotifyCustomizationModuleChanged();
+
+	// Pooled row generators and cached roles point at properties that compiling or reloading replaces
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*> &InReplacementMap) { FContextAndValueDetails::ClearSharedData(); });
+	ReinstancingCompleteHandle = FCoreUObjectDelegates::ReloadReinstancingCompleteDelegate.AddStatic(&FContextAndValueDetails::ClearSharedData);
+
+	// Register the live context inspector
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SDialogueContextInspector::TabName, FOnSpawnTab::CreateStatic(&SDialogueContextInspector::SpawnTab))
+		.SetDisplayName(LOCTEXT("DialogueContextInspector", "Dialogue Context"))
+		.SetTooltipText(LOCTEXT("DialogueContextInspectorTooltip", "Global and actor dialogue context during play in editor"));
+
+	// Register the line pacing report
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SDialoguePacingReport::TabName, FOnSpawnTab::CreateStatic(&SDialoguePacingReport::SpawnTab))
+		.SetDisplayName(LOCTEXT("DialoguePacingReport", "Dialogue Pacing"))
+		.SetTooltipText(LOCTEXT("DialoguePacingReportTooltip", "How long playtesters kept lines on screen, with suggested text timing per script"));
+
+	// Line durations are rebuilt whenever the asset is saved or cooked, and checked against the string tables when loaded
+	LineDurationsHandle = UDialogueLineDurations::OnRebuild.AddStatic(&FDialogueLineDurationsBuilder::Build);
+	LineDurationsVerifyHandle = UDialogueLineDurations::OnVerify.AddStatic(&FDialogueLineDurationsBuilder::Verify);
 }
 
 //==============================================================================================================
@@ -49,6 +74,19 @@ void FSimpleDialogueEditorModule::ShutdownModule()
 		PropertyModule.UnregisterCustomPropertyTypeLayout("ContextAndValue");
 		PropertyModule.NotifyCustomizationModuleChanged();
 	}
+
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::ReloadReinstancingCompleteDelegate.Remove(ReinstancingCompleteHandle);
+	FContextAndValueDetails::ClearSharedData();
+
+	UDialogueLineDurations::OnRebuild.Remove(LineDurationsHandle);
+	UDialogueLineDurations::OnVerify.Remove(LineDurationsVerifyHandle);
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SDialogueContextInspector::TabName);
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SDialoguePacingReport::TabName);
+	}
 }
 
 //==============================================================================================================
@@ -25,4 +25,12 @@ private:
 
 	/** All created asset type actions.  Cached here so that we can unregister them during shutdown. */
 	TArray< TSharedPtr<IAssetTypeActions> > CreatedAssetTypeActions;	
+
+	//UDialogueLineDurations::OnRebuild and OnVerify
+	FDelegateHandle LineDurationsHandle;
+	FDelegateHandle LineDurationsVerifyHandle;
+
+	//Clear FContextAndValueDetails shared data
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle ReinstancingCompleteHandle;
 };
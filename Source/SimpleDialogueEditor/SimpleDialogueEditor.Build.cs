@@ -45,6 +45,10 @@ public class SimpleDialogueEditor : ModuleRules
 				"PropertyEditor",
 				"InputCore",
 				"GameplayTags",
+				"EditorSubsystem",
+				"AssetRegistry",
+				"BlueprintGraph",
+				"Projects",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);